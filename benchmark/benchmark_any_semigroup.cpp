@@ -0,0 +1,153 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Logger = fl::Writer<std::string, Val>;
+using Wrapper = fl::SemigroupWrapper<std::string>;
+
+// Stateless, stored inline
+struct Concat {
+    using ValueType = std::string;
+
+    [[nodiscard]]
+    std::string combine(std::string v1, const std::string &v2) const { return v1.append(v2); }
+
+    void combine_into(std::string &acc, const std::string &v) const { acc.append(v); }
+};
+
+// Stateful, stored on the heap
+struct Joining {
+    using ValueType = std::string;
+
+    std::string separator;
+
+    [[nodiscard]]
+    std::string combine(std::string v1, const std::string &v2) const { return v1.append(separator).append(v2); }
+
+    void combine_into(std::string &acc, const std::string &v) const { acc.append(separator).append(v); }
+};
+
+const std::string entry = "entry";
+
+[[nodiscard]]
+Logger tellStatic(Val steps) {
+    Logger result{};
+    for (Val i = 0; i < steps; ++i) {
+        result = std::move(result).tell(entry);
+    }
+    return result;
+}
+
+// A wrapper is created for each entry, as it happens when a semigroup is passed to tell directly
+template <class S>
+[[nodiscard]]
+Logger tellWrapped(Val steps, const S &sg) {
+    Logger result{};
+    for (Val i = 0; i < steps; ++i) {
+        result = std::move(result).tell(entry, sg);
+    }
+    return result;
+}
+
+[[nodiscard]]
+Logger tellReused(Val steps, const Wrapper &sg) {
+    Logger result{};
+    for (Val i = 0; i < steps; ++i) {
+        result = std::move(result).tell(entry, sg);
+    }
+    return result;
+}
+
+// Entries come in batches, e.g. from a queue
+[[nodiscard]]
+Logger tellBatches(Val steps, Val batch, const Wrapper &sg) {
+    const std::vector<std::string> entries(batch, entry);
+    Logger result{};
+    for (Val i = 0; i < steps; i += batch) {
+        result = std::move(result).tell_all(entries, sg);
+    }
+    return result;
+}
+
+[[nodiscard]]
+Logger tellEachOfBatches(Val steps, Val batch, const Wrapper &sg) {
+    const std::vector<std::string> entries(batch, entry);
+    Logger result{};
+    for (Val i = 0; i < steps; i += batch) {
+        for (const auto &e : entries) {
+            result = std::move(result).tell(e, sg);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Any semigroup benchmark") {
+    const auto steps = GENERATE(Val(100), Val(10'000));
+    const Concat concat;
+    const Joining joining{std::string(32, ' ')};
+    const Wrapper concatWrapper = concat;
+    const Wrapper joiningWrapper = joining;
+
+    BENCHMARK(fmt::format("[Semigroup<std::string>] {} entries", steps)) {
+        return tellStatic(steps);
+    };
+    BENCHMARK(fmt::format("[SemigroupWrapper inline, per entry] {} entries", steps)) {
+        return tellWrapped(steps, concat);
+    };
+    BENCHMARK(fmt::format("[SemigroupWrapper inline, reused] {} entries", steps)) {
+        return tellReused(steps, concatWrapper);
+    };
+    BENCHMARK(fmt::format("[SemigroupWrapper heap, per entry] {} entries", steps)) {
+        return tellWrapped(steps, joining);
+    };
+    BENCHMARK(fmt::format("[SemigroupWrapper heap, reused] {} entries", steps)) {
+        return tellReused(steps, joiningWrapper);
+    };
+
+    SECTION(fmt::format("Logs of {} entries are equal", steps)) {
+        const auto expected = tellStatic(steps).log();
+
+        REQUIRE(tellWrapped(steps, concat).log() == expected);
+        REQUIRE(tellReused(steps, concatWrapper).log() == expected);
+        REQUIRE(tellReused(steps, joiningWrapper).log().size() == expected.size() + steps * joining.separator.size());
+    }
+}
+
+TEST_CASE("Batched tell benchmark") {
+    const Val steps = 10'000;
+    const auto batch = GENERATE(Val(10), Val(100));
+    const Wrapper sg = Joining{std::string(32, ' ')};
+
+    BENCHMARK(fmt::format("[tell] {} entries in batches of {}", steps, batch)) {
+        return tellEachOfBatches(steps, batch, sg);
+    };
+    BENCHMARK(fmt::format("[tell_all] {} entries in batches of {}", steps, batch)) {
+        return tellBatches(steps, batch, sg);
+    };
+
+    SECTION(fmt::format("Logs of batches of {} are equal", batch)) {
+        REQUIRE(tellBatches(steps, batch, sg).log() == tellEachOfBatches(steps, batch, sg).log());
+    }
+}
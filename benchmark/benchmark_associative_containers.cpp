@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <map>
+#include <set>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+template <class C>
+C make(Val from, Val to) {
+    C c;
+    for (Val i = from; i < to; ++i) {
+        if constexpr (requires { typename C::mapped_type; }) {
+            c.emplace(i, i);
+        } else {
+            c.emplace(i);
+        }
+    }
+    return c;
+}
+
+// Combine by inserting moved elements one by one, the rest of c2 is released like a consumed log
+template <class C>
+C insertEach(C c1, C c2) {
+    c1.insert(std::make_move_iterator(c2.begin()), std::make_move_iterator(c2.end()));
+    return c1;
+}
+
+template <class C>
+void benchmarkCombine(const std::string &name, Val size) {
+    BENCHMARK_ADVANCED(fmt::format("[{}] Insert each, {} + {} elements", name, size, size))(
+        Catch::Benchmark::Chronometer meter) {
+        std::vector<C> lhs(meter.runs(), make<C>(0, size));
+        std::vector<C> rhs(meter.runs(), make<C>(size, 2 * size));
+        std::vector<C> results(meter.runs());
+        meter.measure([&](int i) {
+            results[i] = insertEach(std::move(lhs[i]), std::move(rhs[i]));
+            return results[i].size();
+        });
+    };
+
+    BENCHMARK_ADVANCED(fmt::format("[{}] Semigroup, {} + {} elements", name, size, size))(
+        Catch::Benchmark::Chronometer meter) {
+        std::vector<C> lhs(meter.runs(), make<C>(0, size));
+        std::vector<C> rhs(meter.runs(), make<C>(size, 2 * size));
+        std::vector<C> results(meter.runs());
+        meter.measure([&](int i) {
+            results[i] = fl::Semigroup<C>().combine(std::move(lhs[i]), std::move(rhs[i]));
+            return results[i].size();
+        });
+    };
+}
+
+// Each step adds a few entries to the log
+template <class C>
+[[nodiscard]]
+fl::Writer<C, Val> collect(Val steps) {
+    using Logger = fl::Writer<C, Val>;
+
+    Logger result{};
+    for (Val i = 0; i < steps; ++i) {
+        result = std::move(result).and_then([&](Val v) { return Logger{make<C>(i * 4, i * 4 + 4), v + 1}; });
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Associative containers benchmark") {
+    const auto size = GENERATE(Val(1'000), Val(100'000));
+
+    benchmarkCombine<std::set<Val>>("std::set", size);
+    benchmarkCombine<std::unordered_set<Val>>("std::unordered_set", size);
+    benchmarkCombine<std::map<Val, Val>>("std::map", size);
+
+    BENCHMARK(fmt::format("[std::set] Writer, {} steps", size)) {
+        return collect<std::set<Val>>(size).log_.size();
+    };
+    BENCHMARK(fmt::format("[std::unordered_set] Writer, {} steps", size)) {
+        return collect<std::unordered_set<Val>>(size).log_.size();
+    };
+    BENCHMARK(fmt::format("[std::map] Writer, {} steps", size)) {
+        return collect<std::map<Val, Val>>(size).log_.size();
+    };
+
+    SECTION(fmt::format("Logs of {} steps are complete", size)) {
+        REQUIRE(collect<std::set<Val>>(size).log_ == make<std::set<Val>>(0, size * 4));
+        REQUIRE(collect<std::unordered_set<Val>>(size).log_ == make<std::unordered_set<Val>>(0, size * 4));
+        REQUIRE(collect<std::map<Val, Val>>(size).log_ == make<std::map<Val, Val>>(0, size * 4));
+    }
+}
@@ -15,6 +15,7 @@
 #include <fmt/format.h>
 
 #include <fl/writer/all.hpp>
+#include <fl/fmt/format_entry.hpp>
 
 #include "common/logging_fixture.hpp"
 
@@ -29,6 +30,37 @@ Logger factorial(Val i) {
     return (i == 0 ? Logger{{}, 1} : factorial(i - 1).transform(mult)).and_then(tell);
 }
 
+using ChunkedLogger = fl::Writer<fl::ChunkedLog<std::string>, Val>;
+
+[[nodiscard]]
+ChunkedLogger chunked_factorial(Val i) {
+    const auto mult = [&](Val v) { return v * i; };
+    const auto tell = [&](Val ans) { return ChunkedLogger{{fmt::format("Factorial of {} is {}", i, ans)}, ans}; };
+    return (i == 0 ? ChunkedLogger{{}, 1} : chunked_factorial(i - 1).transform(mult)).and_then(tell);
+}
+
+using DeferredLogger = fl::Writer<fl::FormatLog, Val>;
+
+// Entries are formatted when the log is drained
+[[nodiscard]]
+DeferredLogger deferred_factorial(Val i) {
+    const auto mult = [&](Val v) { return v * i; };
+    const auto tell = [&](Val ans) { return fl::tell_fmt(DeferredLogger{{}, ans}, "Factorial of {} is {}", i, ans); };
+    return (i == 0 ? DeferredLogger{{}, 1} : deferred_factorial(i - 1).transform(mult)).and_then(tell);
+}
+
+using NullLogger = fl::Writer<fl::NullLog, Val>;
+
+static_assert(sizeof(NullLogger) == sizeof(Val));
+
+// The same as factorial, but logging is switched off
+[[nodiscard]]
+NullLogger null_factorial(Val i) {
+    const auto mult = [&](Val v) { return v * i; };
+    const auto entry = [&](Val ans) { return fmt::format("Factorial of {} is {}", i, ans); };
+    return (i == 0 ? NullLogger{{}, 1} : null_factorial(i - 1).transform(mult)).tell_with(entry);
+}
+
 // Add some logging
 template <class L>
 [[nodiscard]]
@@ -59,6 +91,34 @@ TEST_CASE_METHOD(common::util::LoggingFixture, "Factorial benchmark") {
         }
         return v;
     };
+    BENCHMARK(fmt::format("[Writer ChunkedLog] Factorial of {}", value)) {
+        const auto &[l, v] = chunked_factorial(value);
+        for (const auto &chunk : l.chunks()) {
+            for (const auto &s : chunk) {
+                logger()->info(s);
+            }
+        }
+        return v;
+    };
+    BENCHMARK(fmt::format("[Writer FormatLog] Factorial of {}", value)) {
+        const auto &[l, v] = deferred_factorial(value);
+        for (const auto &e : l) {
+            logger()->info(e.str());
+        }
+        return v;
+    };
+    BENCHMARK(fmt::format("[Writer] Factorial of {}, log is dropped", value)) {
+        return factorial(value).reset().value();
+    };
+    BENCHMARK(fmt::format("[Writer FormatLog] Factorial of {}, log is dropped", value)) {
+        return deferred_factorial(value).reset().value();
+    };
+    BENCHMARK(fmt::format("[Writer NullLog] Factorial of {}", value)) {
+        return null_factorial(value).value();
+    };
+    BENCHMARK(fmt::format("[No logging] Factorial of {}", value)) {
+        return factorial_no_logging(value);
+    };
     BENCHMARK(fmt::format("[Just] Factorial of {}", value)) {
         return just_factorial(value, logger());
     };
@@ -69,6 +129,21 @@ TEST_CASE_METHOD(common::util::LoggingFixture, "Factorial benchmark") {
 
     SECTION(fmt::format("All factorials of {} are equal", value)) {
         REQUIRE(factorial(value).value() == factorial_no_logging(value));
+        REQUIRE(chunked_factorial(value).value() == factorial_no_logging(value));
+        REQUIRE(null_factorial(value).value() == factorial_no_logging(value));
+    }
+
+    SECTION(fmt::format("Deferred log of factorial of {} is the same", value)) {
+        Log l;
+        for (const auto &e : deferred_factorial(value).log()) {
+            l.push_back(e.str());
+        }
+        REQUIRE(l == factorial(value).log());
+    }
+
+    SECTION(fmt::format("Chunked log of factorial of {} is the same", value)) {
+        const auto l = chunked_factorial(value).log();
+        REQUIRE(Log(l.begin(), l.end()) == factorial(value).log());
     }
 }
 
@@ -0,0 +1,87 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+// Entries are longer than the SSO buffer
+template <class Log>
+[[nodiscard]]
+std::vector<fl::Writer<Log, Val>> parts(Val count, Val entries) {
+    std::vector<fl::Writer<Log, Val>> result(count);
+    for (Val i = 0; i < count; ++i) {
+        for (Val e = 0; e < entries; ++e) {
+            auto entry = fmt::format("Part {:>4}, entry {:>2}: the value is incremented", i, e);
+            result[i] = std::move(result[i]).tell(std::move(entry));
+        }
+    }
+    return result;
+}
+
+// Parts are shared, so they are copied into the result
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> combine(const std::vector<fl::Writer<Log, Val>> &parts) {
+    fl::Writer<Log, Val> result{};
+    for (const auto &p : parts) {
+        result = std::move(result).and_then([&](Val v) { return p.transform([v](Val) { return v + 1; }); });
+    }
+    return result;
+}
+
+template <class Log>
+[[nodiscard]]
+Val drain(const Log &log) {
+    Val result{};
+    for (std::string_view entry : log) {
+        result += entry.size() + Val(entry.back());
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Flat string log benchmark") {
+    const auto count = GENERATE(Val(10), Val(1'000));
+    const Val entries = 10;
+
+    const auto vectorParts = parts<std::vector<std::string>>(count, entries);
+    const auto flatParts = parts<fl::FlatStringLog>(count, entries);
+
+    BENCHMARK(fmt::format("[std::vector<std::string>] combine {} logs of {} entries", count, entries)) {
+        return combine(vectorParts);
+    };
+    BENCHMARK(fmt::format("[FlatStringLog] combine {} logs of {} entries", count, entries)) {
+        return combine(flatParts);
+    };
+
+    const auto vectorLog = combine(vectorParts).log();
+    const auto flatLog = combine(flatParts).log();
+
+    BENCHMARK(fmt::format("[std::vector<std::string>] drain {} entries", count * entries)) {
+        return drain(vectorLog);
+    };
+    BENCHMARK(fmt::format("[FlatStringLog] drain {} entries", count * entries)) {
+        return drain(flatLog);
+    };
+
+    SECTION(fmt::format("Logs of {} entries are equal", count * entries)) {
+        REQUIRE(std::equal(vectorLog.begin(), vectorLog.end(), flatLog.begin(), flatLog.end()));
+    }
+}
@@ -0,0 +1,63 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+struct ExactLog : std::vector<Val> { using std::vector<Val>::vector; };
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> sumWithLogger(Val upTo) {
+    using Logger = fl::Writer<Log, Val>;
+
+    Logger result{};
+    for (Val i = 0; i < upTo; ++i) {
+        result = std::move(result).and_then([&](Val v) { return Logger{{i}, v + 1}; });
+    }
+    return result;
+}
+
+} // namespace
+
+template <>
+struct fl::growth_policy<ExactLog> { using type = fl::growth::Exact; };
+
+TEST_CASE("Growth policy benchmark") {
+    const auto tells = GENERATE(Val(1'000), Val(10'000), Val(100'000), Val(1'000'000));
+
+    BENCHMARK(fmt::format("[Geometric] {} tells", tells)) {
+        return sumWithLogger<std::vector<Val>>(tells).value();
+    };
+
+    // Quadratic, so only small logs are measured
+    if (tells <= 10'000) {
+        BENCHMARK(fmt::format("[Exact] {} tells", tells)) {
+            return sumWithLogger<ExactLog>(tells).value();
+        };
+    }
+
+    SECTION(fmt::format("Log of {} tells is complete", tells)) {
+        const auto [l, v] = sumWithLogger<std::vector<Val>>(tells);
+
+        REQUIRE(v == tells);
+        REQUIRE(l.size() == tells);
+        REQUIRE(l.capacity() < 2 * tells);
+    }
+}
@@ -0,0 +1,62 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+// Short-lived writers with a few entries each
+template <class Log>
+[[nodiscard]]
+Val shortWriters(Val count, Val entries) {
+    using Logger = fl::Writer<Log, Val>;
+
+    Val result{};
+    for (Val i = 0; i < count; ++i) {
+        auto w = Logger{{}, i};
+        for (Val e = 0; e < entries; ++e) {
+            w = std::move(w).and_then([](Val v) { return Logger{{v}, v + 1}; });
+        }
+        result += w.log().size() + w.value();
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Inline vector benchmark") {
+    const Val count = 1'000;
+    const auto entries = GENERATE(Val(2), Val(8));
+
+    BENCHMARK(fmt::format("[std::vector] {} writers with {} entries", count, entries)) {
+        return shortWriters<std::vector<Val>>(count, entries);
+    };
+    BENCHMARK(fmt::format("[SmallVector] {} writers with {} entries", count, entries)) {
+        return shortWriters<fl::SmallVector<Val, 8>>(count, entries);
+    };
+    BENCHMARK(fmt::format("[StaticVector] {} writers with {} entries", count, entries)) {
+        return shortWriters<fl::StaticVector<Val, 8>>(count, entries);
+    };
+
+    SECTION(fmt::format("Results for {} entries are equal", entries)) {
+        const auto expected = shortWriters<std::vector<Val>>(count, entries);
+
+        REQUIRE(shortWriters<fl::SmallVector<Val, 8>>(count, entries) == expected);
+        REQUIRE(shortWriters<fl::StaticVector<Val, 8>>(count, entries) == expected);
+    }
+}
@@ -0,0 +1,92 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <array>
+
+#include <fmt/format.h>
+
+#include <fl/logs/interned.hpp>
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+// A few message templates repeated many times
+const std::array<std::string_view, 4> messages{
+    "Request has been received from the load balancer",
+    "Cache entry for the request has not been found",
+    "Response has been sent to the load balancer",
+    "Request handling has been finished successfully",
+};
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> handle(Val requests) {
+    using Logger = fl::Writer<Log, Val>;
+
+    Logger result{};
+    for (Val i = 0; i < requests; ++i) {
+        result = std::move(result).and_then([](Val v) {
+            Logger w{{}, v + 1};
+            for (auto m : messages) {
+                if constexpr (std::is_same_v<Log, fl::InternedLog<>>) {
+                    w = std::move(w).tell(fl::intern(m));
+                } else {
+                    w = std::move(w).tell(std::string(m));
+                }
+            }
+            return w;
+        });
+    }
+    return result;
+}
+
+// Entries and the heap blocks of long strings
+[[nodiscard]]
+std::size_t bytes(const std::vector<std::string> &log) {
+    std::size_t result = log.capacity() * sizeof(std::string);
+    for (const auto &s : log) {
+        result += s.capacity() > 15 ? s.capacity() + 1 : 0;
+    }
+    return result;
+}
+
+[[nodiscard]]
+std::size_t bytes(const fl::InternedLog<> &log) { return log.capacity() * sizeof(fl::Interned<>); }
+
+} // namespace
+
+TEST_CASE("Interned log benchmark") {
+    const auto requests = GENERATE(Val(100), Val(10'000));
+
+    BENCHMARK(fmt::format("[std::vector<std::string>] {} requests", requests)) {
+        return handle<std::vector<std::string>>(requests);
+    };
+    BENCHMARK(fmt::format("[InternedLog] {} requests", requests)) {
+        return handle<fl::InternedLog<>>(requests);
+    };
+
+    SECTION(fmt::format("Memory for {} requests", requests)) {
+        const auto strings = handle<std::vector<std::string>>(requests).log();
+        const auto interned = handle<fl::InternedLog<>>(requests).log();
+
+        fmt::print("{} entries, bytes: std::vector<std::string> -- {}, InternedLog -- {}\n",
+                   strings.size(), bytes(strings), bytes(interned));
+
+        REQUIRE(std::equal(strings.begin(), strings.end(), interned.begin(), interned.end(),
+                           [](const auto &s, const auto &e) { return s == e.str(); }));
+        REQUIRE(bytes(strings) >= 10 * bytes(interned));
+    }
+}
@@ -0,0 +1,74 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Logger = fl::Writer<std::vector<fl::Leveled<std::string>>, Val>;
+
+// Debug entry on each step, info entry at the end
+template <class Filter>
+[[nodiscard]]
+Logger sum(Val upTo, Filter &&filter) {
+    Logger result{};
+    for (Val i = 0; i < upTo; ++i) {
+        result = fl::tell_at<fl::Level::Debug>(
+            std::move(result).transform([&](Val v) { return v + i; }),
+            filter,
+            [&](Val v) { return fmt::format("Add {}, sum is {}", i, v); });
+    }
+    return fl::tell_at<fl::Level::Info>(std::move(result), filter, [](Val v) { return fmt::format("Sum is {}", v); });
+}
+
+[[nodiscard]]
+Logger sumTellAll(Val upTo) {
+    Logger result{};
+    for (Val i = 0; i < upTo; ++i) {
+        result = std::move(result).transform([&](Val v) { return v + i; });
+        auto entry = fmt::format("Add {}, sum is {}", i, result.value_);
+        result = std::move(result).tell(fl::Leveled{fl::Level::Debug, std::move(entry)});
+    }
+    return std::move(result).tell(fl::Leveled{fl::Level::Info, fmt::format("Sum is {}", result.value_)});
+}
+
+} // namespace
+
+TEST_CASE("Leveled tell benchmark") {
+    const auto steps = GENERATE(Val(100), Val(10'000));
+
+    BENCHMARK(fmt::format("[Tell all] {} steps", steps)) {
+        return sumTellAll(steps).value();
+    };
+    BENCHMARK(fmt::format("[Threshold] {} steps", steps)) {
+        return sum(steps, fl::filters::Threshold{fl::Level::Info}).value();
+    };
+    BENCHMARK(fmt::format("[StaticThreshold] {} steps", steps)) {
+        return sum(steps, fl::filters::StaticThreshold<fl::Level::Info>{}).value();
+    };
+    BENCHMARK(fmt::format("[Sampling 1/100] {} steps", steps)) {
+        return sum(steps, fl::filters::Sampling(100)).value();
+    };
+
+    SECTION(fmt::format("Only info entries are kept for {} steps", steps)) {
+        const auto l = sum(steps, fl::filters::Threshold{fl::Level::Info}).log();
+
+        REQUIRE(l.size() == 1);
+        REQUIRE(l.front().level == fl::Level::Info);
+        REQUIRE(sum(steps, fl::filters::Threshold{fl::Level::Debug}).log() == sumTellAll(steps).log());
+    }
+}
@@ -0,0 +1,85 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Strings = std::vector<std::string>;
+
+template <class Log>
+[[nodiscard]]
+std::vector<Log> parts(Val count, const Log &part) {
+    return std::vector<Log>(count, part);
+}
+
+// The usual way: combine logs one by one. The accumulator is moved, but it grows with every combine
+template <class Log>
+[[nodiscard]]
+Log pairwise(const std::vector<Log> &logs) {
+    fl::Monoid<Log> m;
+    auto result = m.identity();
+    for (const auto &l : logs) {
+        result = m.combine(std::move(result), l);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Concat benchmark") {
+    const auto count = GENERATE(Val(10), Val(100), Val(1'000));
+    const auto strings = parts(count, std::string(64, 'a'));
+    const auto vectors = parts(count, Strings{"1", "2", "3", "4"});
+
+    BENCHMARK(fmt::format("[pairwise] {} strings", count)) {
+        return pairwise(strings);
+    };
+    BENCHMARK(fmt::format("[mconcat] {} strings", count)) {
+        return fl::mconcat(strings);
+    };
+    BENCHMARK(fmt::format("[pairwise] {} vectors", count)) {
+        return pairwise(vectors);
+    };
+    BENCHMARK(fmt::format("[mconcat] {} vectors", count)) {
+        return fl::mconcat(vectors);
+    };
+
+    SECTION(fmt::format("Concatenated {} logs are equal", count)) {
+        REQUIRE(fl::mconcat(strings) == pairwise(strings));
+        REQUIRE(fl::mconcat(vectors) == pairwise(vectors));
+    }
+}
+
+TEST_CASE("Variadic combine benchmark") {
+    const fl::Semigroup<std::string> s;
+    const std::string part(64, 'a');
+
+    BENCHMARK("[pairwise] 4 strings") {
+        return s.combine(s.combine(s.combine(part, part), part), part);
+    };
+    BENCHMARK("[variadic] 4 strings") {
+        return s.combine(part, part, part, part);
+    };
+
+    SECTION("Combined strings are equal") {
+        REQUIRE(s.combine(part, part, part, part) == s.combine(s.combine(s.combine(part, part), part), part));
+    }
+}
@@ -0,0 +1,70 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <array>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Counters = fl::MergeMap<std::string, Val, std::unordered_map<std::string, Val>>;
+
+const std::array<std::string, 4> keys{"requests", "cache hits", "cache misses", "errors"};
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> handle(Val requests) {
+    fl::Writer<Log, Val> result{};
+    for (Val i = 0; i < requests; ++i) {
+        const auto &key = keys[i % keys.size()];
+        if constexpr (std::is_same_v<Log, Counters>) {
+            result = std::move(result).tell(std::pair{key, Val(1)});
+        } else {
+            result = std::move(result).tell(fmt::format("{}: {}", key, 1));
+        }
+    }
+    return result;
+}
+
+// The usual way: parse collected messages afterward
+[[nodiscard]]
+std::unordered_map<std::string, Val> aggregate(const std::vector<std::string> &log) {
+    std::unordered_map<std::string, Val> result;
+    for (const auto &entry : log) {
+        const auto separator = entry.rfind(": ");
+        result[entry.substr(0, separator)] += std::stoull(entry.substr(separator + 2));
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Merge map benchmark") {
+    const auto requests = GENERATE(Val(100), Val(10'000));
+
+    BENCHMARK(fmt::format("[std::vector<std::string> + aggregation] {} requests", requests)) {
+        return aggregate(handle<std::vector<std::string>>(requests).log());
+    };
+    BENCHMARK(fmt::format("[MergeMap] {} requests", requests)) {
+        return handle<Counters>(requests).log().map();
+    };
+
+    SECTION(fmt::format("Results for {} requests are equal", requests)) {
+        REQUIRE(aggregate(handle<std::vector<std::string>>(requests).log()) == handle<Counters>(requests).log().map());
+    }
+}
@@ -0,0 +1,143 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <algorithm>
+#include <valarray>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Latency = fl::Histogram<Val(0), Val(10'000), 100>;
+using Hdr = fl::HdrHistogram<>;
+
+// Pseudo-random latencies in microseconds
+[[nodiscard]]
+Val latency(Val request) { return request * 7919 % 10'000; }
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> handle(Val requests) {
+    fl::Writer<Log, Val> result{};
+    for (Val i = 0; i < requests; ++i) {
+        if constexpr (std::is_same_v<Log, std::vector<std::string>>) {
+            result = std::move(result).tell(fmt::format("latency: {}us", latency(i)));
+        } else {
+            result = std::move(result).tell(latency(i));
+        }
+    }
+    return result;
+}
+
+// The usual way: parse collected messages and sort latencies afterward
+[[nodiscard]]
+Val p99(const std::vector<std::string> &log) {
+    std::vector<Val> latencies;
+    latencies.reserve(log.size());
+    for (const auto &entry : log) {
+        latencies.push_back(std::stoull(entry.substr(entry.find(' ') + 1)));
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[(latencies.size() * 99 + 99) / 100 - 1];
+}
+
+// Histograms collected by several workers are merged into one
+template <class H>
+[[nodiscard]]
+H mergeAll(const std::vector<H> &parts) {
+    fl::Monoid<H> m;
+    auto result = m.identity();
+    for (const auto &h : parts) {
+        fl::combine_into(m, result, h);
+    }
+    return result;
+}
+
+// Element-wise addition as it was before the blocked loop, the pointers may alias
+void addPlain(Val *acc, const Val *v, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        acc[i] += v[i];
+    }
+}
+
+} // namespace
+
+TEST_CASE("Metrics benchmark") {
+    const auto requests = GENERATE(Val(100), Val(10'000));
+
+    BENCHMARK(fmt::format("[std::vector<std::string> + sort] p99 of {} requests", requests)) {
+        return p99(handle<std::vector<std::string>>(requests).log());
+    };
+    BENCHMARK(fmt::format("[Histogram] p99 of {} requests", requests)) {
+        return handle<Latency>(requests).log().value_at_quantile(0.99);
+    };
+    BENCHMARK(fmt::format("[HdrHistogram] p99 of {} requests", requests)) {
+        return handle<Hdr>(requests).log().value_at_quantile(0.99);
+    };
+
+    SECTION(fmt::format("p99 of {} requests are close", requests)) {
+        const auto expected = p99(handle<std::vector<std::string>>(requests).log());
+        const auto hdr = handle<Hdr>(requests).log().value_at_quantile(0.99);
+
+        REQUIRE(hdr <= expected);
+        REQUIRE(expected - hdr <= expected / 32);
+        REQUIRE(expected - handle<Latency>(requests).log().value_at_quantile(0.99) < 100);
+    }
+}
+
+TEST_CASE("Histogram merge benchmark") {
+    const auto workers = GENERATE(Val(8), Val(64));
+
+    std::vector<Latency> latencies(workers);
+    std::vector<Hdr> hdrs(workers);
+    for (Val w = 0; w < workers; ++w) {
+        for (Val i = 0; i < 1'000; ++i) {
+            latencies[w].record(latency(w * 1'000 + i));
+            hdrs[w].record(latency(w * 1'000 + i));
+        }
+    }
+
+    BENCHMARK(fmt::format("[Histogram] Merge {} workers", workers)) {
+        return mergeAll(latencies);
+    };
+    BENCHMARK(fmt::format("[HdrHistogram] Merge {} workers", workers)) {
+        return mergeAll(hdrs);
+    };
+
+    SECTION(fmt::format("Totals of {} workers are equal", workers)) {
+        REQUIRE(mergeAll(latencies).total() == workers * 1'000);
+        REQUIRE(mergeAll(hdrs).total() == workers * 1'000);
+    }
+}
+
+TEST_CASE("Element-wise merge benchmark") {
+    const auto size = GENERATE(std::size_t(1'024), std::size_t(65'536));
+
+    std::valarray<Val> acc(Val(1), size);
+    const std::valarray<Val> v(Val(2), size);
+    const fl::Semigroup<std::valarray<Val>> sg;
+
+    BENCHMARK(fmt::format("[Plain loop] Add {} counters", size)) {
+        addPlain(&acc[0], &v[0], size);
+        return acc[size - 1];
+    };
+    BENCHMARK(fmt::format("[Semigroup<std::valarray>] Add {} counters", size)) {
+        sg.combine_into(acc, v);
+        return acc[size - 1];
+    };
+}
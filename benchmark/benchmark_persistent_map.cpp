@@ -0,0 +1,101 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using StdMap = std::map<Val, Val>;
+using Map = fl::PersistentMap<Val, Val>;
+
+// Every step keeps the previous writer, so its log is copied
+template <class Log>
+[[nodiscard]]
+std::vector<fl::Writer<Log, Val>> snapshots(Val steps) {
+    std::vector<fl::Writer<Log, Val>> result{fl::Writer<Log, Val>{}};
+    result.reserve(steps + 1);
+    for (Val i = 0; i < steps; ++i) {
+        const auto &last = result.back();
+        result.push_back(last.tell(std::pair{i, i * i}));
+    }
+    return result;
+}
+
+template <class Log>
+[[nodiscard]]
+Log state(Val size) {
+    Log result;
+    for (Val i = 0; i < size; ++i) {
+        fl::combine_into(fl::Semigroup<Log>(), result, std::pair{i, i});
+    }
+    return result;
+}
+
+// A few keys are added to a copy of the base state, then both are merged
+template <class Log>
+[[nodiscard]]
+Log mergeChanged(const Log &base) {
+    auto changed = base;
+    for (Val i = 0; i < 10; ++i) {
+        fl::combine_into(fl::Semigroup<Log>(), changed, std::pair{Val(1'000'000) + i, i});
+    }
+    return fl::Semigroup<Log>().combine(base, changed);
+}
+
+} // namespace
+
+TEST_CASE("Persistent map benchmark") {
+    const auto steps = GENERATE(Val(100), Val(1'000));
+
+    BENCHMARK(fmt::format("[std::map] {} snapshots", steps)) {
+        return snapshots<StdMap>(steps);
+    };
+    BENCHMARK(fmt::format("[PersistentMap] {} snapshots", steps)) {
+        return snapshots<Map>(steps);
+    };
+
+    SECTION(fmt::format("Last of {} snapshots are equal", steps)) {
+        const auto expected = snapshots<StdMap>(steps).back().log();
+        const auto last = snapshots<Map>(steps).back().log();
+
+        REQUIRE(last.size() == expected.size());
+        for (const auto &[key, value] : expected) {
+            REQUIRE(last.at(key) == value);
+        }
+    }
+}
+
+TEST_CASE("Persistent map merge benchmark") {
+    const auto size = GENERATE(Val(10'000), Val(100'000));
+    const auto stdBase = state<StdMap>(size);
+    const auto base = state<Map>(size);
+
+    BENCHMARK(fmt::format("[std::map] Merge {} entries with a few changes", size)) {
+        return mergeChanged(stdBase);
+    };
+    BENCHMARK(fmt::format("[PersistentMap] Merge {} entries with a few changes", size)) {
+        return mergeChanged(base);
+    };
+
+    SECTION(fmt::format("Merged {} entries are equal", size)) {
+        REQUIRE(mergeChanged(stdBase).size() == size + 10);
+        REQUIRE(mergeChanged(base).size() == size + 10);
+    }
+}
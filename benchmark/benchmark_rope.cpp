@@ -0,0 +1,66 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+using Val = std::uint64_t;
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> textLog(Val lines) {
+    using Logger = fl::Writer<Log, Val>;
+
+    Logger result{};
+    for (Val i = 0; i < lines; ++i) {
+        result = std::move(result)
+            .transform([](Val v) { return ++v; })
+            .and_then([&](Val v) { return Logger{fmt::format("{} - {}\n", i, v), v}; });
+    }
+    return result;
+}
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> textLogTell(Val lines) {
+    fl::Writer<Log, Val> result{};
+    for (Val i = 0; i < lines; ++i) {
+        result = std::move(result).tell(fmt::format("{} - {}\n", i, i));
+    }
+    return result;
+}
+
+TEST_CASE("Rope benchmark") {
+    const auto lines = GENERATE(Val(100), Val(1'000), Val(10'000));
+
+    BENCHMARK(fmt::format("[std::string] And then {} lines", lines)) {
+        return textLog<std::string>(lines).log().size();
+    };
+    BENCHMARK(fmt::format("[Rope] And then {} lines", lines)) {
+        return textLog<fl::Rope>(lines).log().str().size();
+    };
+
+    BENCHMARK(fmt::format("[std::string] Tell {} lines", lines)) {
+        return textLogTell<std::string>(lines).log().size();
+    };
+    BENCHMARK(fmt::format("[Rope] Tell {} lines", lines)) {
+        return textLogTell<fl::Rope>(lines).log().str().size();
+    };
+
+    SECTION(fmt::format("Logs of {} lines are equal", lines)) {
+        REQUIRE(textLog<fl::Rope>(lines).log() == textLog<std::string>(lines).log());
+        REQUIRE(textLogTell<fl::Rope>(lines).log() == textLogTell<std::string>(lines).log());
+    }
+}
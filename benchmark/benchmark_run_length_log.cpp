@@ -0,0 +1,64 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+// The same few entries are told in a tight loop
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> sum(Val upTo) {
+    using Logger = fl::Writer<Log, Val>;
+
+    Logger result{};
+    for (Val i = 0; i <= upTo; ++i) {
+        result = std::move(result)
+            .transform([](Val v) { return v + 1; })
+            .and_then([](Val v) {
+                return Logger{{v % 2 == 0 ? "The value is even, so it is incremented" : "The value is odd"}, v};
+            });
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Run-length log benchmark") {
+    const auto value = GENERATE(Val(100), Val(10'000));
+
+    BENCHMARK(fmt::format("[std::vector<std::string>] Sum of {}", value)) {
+        return sum<std::vector<std::string>>(value);
+    };
+    BENCHMARK(fmt::format("[RunLengthLog Consecutive] Sum of {}", value)) {
+        return sum<fl::RunLengthLog<std::string>>(value);
+    };
+    BENCHMARK(fmt::format("[RunLengthLog Global] Sum of {}", value)) {
+        return sum<fl::RunLengthLog<std::string, fl::dedup::Global>>(value);
+    };
+
+    SECTION(fmt::format("Sums of {} are equal", value)) {
+        const auto expected = sum<std::vector<std::string>>(value);
+        const auto global = sum<fl::RunLengthLog<std::string, fl::dedup::Global>>(value);
+
+        REQUIRE(sum<fl::RunLengthLog<std::string>>(value).value() == expected.value());
+        REQUIRE(global.value() == expected.value());
+        REQUIRE(global.log().size() == 2);
+        REQUIRE(global.log().entries_count() == expected.log().size());
+    }
+}
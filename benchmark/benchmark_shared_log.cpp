@@ -0,0 +1,100 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+struct Entry {
+    static inline std::size_t copies = 0;
+
+    explicit Entry(std::string s) : value(std::move(s)) {}
+    Entry(const Entry &other) : value(other.value) { ++copies; }
+    Entry(Entry &&) noexcept = default;
+    Entry &operator=(const Entry &other) { value = other.value; ++copies; return *this; }
+    Entry &operator=(Entry &&) noexcept = default;
+
+    bool operator==(const Entry &) const = default;
+
+    std::string value;
+};
+
+using Val = std::uint64_t;
+using Log = std::vector<Entry>;
+
+template <class L>
+[[nodiscard]]
+fl::Writer<L, Val> base(Val entries) {
+    fl::Writer<L, Val> result{};
+    for (Val i = 0; i < entries; ++i) {
+        result = std::move(result).tell(Entry{fmt::format("Base entry {}", i)});
+    }
+    return result;
+}
+
+// Every branch starts from the same base writer
+template <class L>
+[[nodiscard]]
+Val branches(const fl::Writer<L, Val> &base, Val count) {
+    using Logger = fl::Writer<L, Val>;
+
+    Val result{};
+    for (Val i = 0; i < count; ++i) {
+        const auto branch = base
+            .tell(Entry{fmt::format("Branch {}", i)})
+            .and_then([&](Val v) { return Logger{{}, v + i}.tell(Entry{fmt::format("Value {}", v + i)}); });
+        result += branch.value();
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Shared log benchmark") {
+    const auto baseEntries = GENERATE(Val(10), Val(100), Val(1'000));
+    const Val branchesCount = 100;
+
+    const auto vectorBase = base<Log>(baseEntries);
+    const auto sharedBase = base<fl::SharedLog<Log>>(baseEntries);
+
+    BENCHMARK(fmt::format("[std::vector] {} branches from {} entries", branchesCount, baseEntries)) {
+        return branches(vectorBase, branchesCount);
+    };
+    BENCHMARK(fmt::format("[SharedLog] {} branches from {} entries", branchesCount, baseEntries)) {
+        return branches(sharedBase, branchesCount);
+    };
+
+    SECTION(fmt::format("Copies of entries for {} base entries", baseEntries)) {
+        Entry::copies = 0;
+        const auto vectorResult = branches(vectorBase, branchesCount);
+        const auto vectorCopies = Entry::copies;
+
+        Entry::copies = 0;
+        const auto sharedResult = branches(sharedBase, branchesCount);
+        const auto sharedCopies = Entry::copies;
+
+        fmt::print("{} branches from {} entries, copies of entries: std::vector -- {}, SharedLog -- {}\n",
+                   branchesCount, baseEntries, vectorCopies, sharedCopies);
+
+        REQUIRE(vectorResult == sharedResult);
+        REQUIRE(sharedCopies == 0);
+        REQUIRE(vectorCopies >= branchesCount * baseEntries);
+    }
+
+    SECTION(fmt::format("Logs of {} base entries are equal", baseEntries)) {
+        REQUIRE(sharedBase.log().flatten() == vectorBase.log());
+    }
+}
@@ -0,0 +1,138 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+using Distinct = fl::HyperLogLog<Val>;
+
+// Pseudo-random user ids, about a half of them are repeated
+[[nodiscard]]
+Val user(Val request) { return request * 7919 % (request / 2 + 1); }
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> handle(Val from, Val to) {
+    fl::Writer<Log, Val> result{};
+    for (Val i = from; i < to; ++i) {
+        result = std::move(result).tell(user(i));
+    }
+    return result;
+}
+
+// The usual way: keep all ids and remove duplicates afterward
+[[nodiscard]]
+Val distinct(std::vector<Val> ids) {
+    std::sort(ids.begin(), ids.end());
+    return Val(std::unique(ids.begin(), ids.end()) - ids.begin());
+}
+
+// Logs collected by several workers are merged into one
+template <class Log>
+[[nodiscard]]
+Log mergeAll(const std::vector<Log> &parts) {
+    fl::Monoid<Log> m;
+    auto result = m.identity();
+    for (const auto &l : parts) {
+        fl::combine_into(m, result, l);
+    }
+    return result;
+}
+
+// Register-wise maximum as it was before the blocked loop, the pointers may alias
+void maxPlain(std::uint8_t *acc, const std::uint8_t *v, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        acc[i] = std::max(acc[i], v[i]);
+    }
+}
+
+template <std::size_t Precision>
+void benchmarkRegisterMerge() {
+    using Sketch = fl::HyperLogLog<Val, Precision>;
+
+    Sketch acc;
+    Sketch other;
+    for (Val i = 0; i < 10'000; ++i) {
+        acc.add(i);
+        other.add(i + 5'000);
+    }
+    auto plain = acc.registers();
+
+    BENCHMARK(fmt::format("[Plain loop] Max of {} registers", Sketch::register_count)) {
+        maxPlain(plain.data(), other.registers().data(), plain.size());
+        return plain.back();
+    };
+    BENCHMARK(fmt::format("[HyperLogLog] Max of {} registers", Sketch::register_count)) {
+        return acc.merge(other).registers().back();
+    };
+
+    REQUIRE(acc.registers() == plain);
+}
+
+} // namespace
+
+TEST_CASE("Sketches benchmark") {
+    const auto requests = GENERATE(Val(1'000), Val(100'000));
+
+    BENCHMARK(fmt::format("[std::vector<Val> + sort] Distinct users of {} requests", requests)) {
+        return distinct(handle<std::vector<Val>>(0, requests).log());
+    };
+    BENCHMARK(fmt::format("[HyperLogLog] Distinct users of {} requests", requests)) {
+        return handle<Distinct>(0, requests).log().estimate();
+    };
+
+    SECTION(fmt::format("Distinct users of {} requests are close", requests)) {
+        const auto expected = double(distinct(handle<std::vector<Val>>(0, requests).log()));
+
+        REQUIRE(std::abs(handle<Distinct>(0, requests).log().estimate() - expected) < expected * 0.05);
+    }
+}
+
+TEST_CASE("Sketches merge benchmark") {
+    const Val workers = 64;
+    const Val requests = 10'000;
+
+    std::vector<std::vector<Val>> ids;
+    std::vector<Distinct> sketches;
+    for (Val w = 0; w < workers; ++w) {
+        ids.push_back(handle<std::vector<Val>>(w * requests, (w + 1) * requests).log());
+        sketches.push_back(handle<Distinct>(w * requests, (w + 1) * requests).log());
+    }
+
+    BENCHMARK(fmt::format("[std::vector<Val> + sort] Merge {} workers", workers)) {
+        return distinct(mergeAll(ids));
+    };
+    BENCHMARK(fmt::format("[HyperLogLog] Merge {} workers", workers)) {
+        return mergeAll(sketches).estimate();
+    };
+
+    SECTION("Merged estimates are close") {
+        const auto expected = double(distinct(mergeAll(ids)));
+
+        REQUIRE(std::abs(mergeAll(sketches).estimate() - expected) < expected * 0.05);
+    }
+}
+
+TEST_CASE("Sketch registers merge benchmark") {
+    benchmarkRegisterMerge<12>();
+    benchmarkRegisterMerge<16>();
+}
@@ -0,0 +1,69 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#define CATCH_CONFIG_USE_ASYNC
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "catch.hpp"
+
+#include <fmt/format.h>
+
+#include <fl/writer/all.hpp>
+#include <fl/fmt/tell_format.hpp>
+
+namespace {
+
+using Val = std::uint64_t;
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> textLogTell(Val lines) {
+    fl::Writer<Log, Val> result{Log(), 0};
+    for (Val i = 0; i < lines; ++i) {
+        result = std::move(result).tell(fmt::format("{} - {}\n", i, i));
+    }
+    return result;
+}
+
+template <class Log>
+[[nodiscard]]
+fl::Writer<Log, Val> textLogTellFormat(Val lines) {
+    fl::Writer<Log, Val> result{Log(), 0};
+    for (Val i = 0; i < lines; ++i) {
+        result = fl::tell_format(std::move(result), "{} - {}\n", i, i);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Tell format benchmark") {
+    const auto lines = GENERATE(Val(1), Val(10), Val(1'000), Val(100'000));
+
+    BENCHMARK(fmt::format("[std::string] Tell {} lines", lines)) {
+        return textLogTell<std::string>(lines).log_.size();
+    };
+    BENCHMARK(fmt::format("[std::string] Tell format {} lines", lines)) {
+        return textLogTellFormat<std::string>(lines).log_.size();
+    };
+    BENCHMARK(fmt::format("[fmt::memory_buffer] Tell {} lines", lines)) {
+        return textLogTell<fmt::memory_buffer>(lines).log_.size();
+    };
+    BENCHMARK(fmt::format("[fmt::memory_buffer] Tell format {} lines", lines)) {
+        return textLogTellFormat<fmt::memory_buffer>(lines).log_.size();
+    };
+
+    SECTION(fmt::format("Logs of {} lines are equal", lines)) {
+        const auto expected = textLogTell<std::string>(lines).log();
+
+        REQUIRE(textLogTellFormat<std::string>(lines).log() == expected);
+        REQUIRE(fmt::to_string(textLogTell<fmt::memory_buffer>(lines).log_) == expected);
+        REQUIRE(fmt::to_string(textLogTellFormat<fmt::memory_buffer>(lines).log_) == expected);
+    }
+}
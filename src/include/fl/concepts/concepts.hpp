@@ -65,6 +65,11 @@ concept IsProbablySemigroup = requires(S s, V &&v1, V &&v2) {
 template <class V>
 concept WithSemigroup = requires { Semigroup<V>(); };
 
+template<class S, class V, class Entry>
+concept CombinableInto = requires(const S &s, std::remove_reference_t<V> &acc, Entry &&e) {
+    s.combine_into(acc, std::forward<Entry>(e));
+};
+
 template <class TellEntry, class WriterLogType>
 concept ValidTellEntry = WithSemigroup<WriterLogType> && details::CombinableWithSg<TellEntry, WriterLogType, Semigroup<WriterLogType>>;
 
@@ -0,0 +1,194 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <fl/concepts/concepts.hpp>
+
+// This header requires {fmt}, it's not included by fl/writer/all.hpp
+namespace fl {
+
+/*!
+ * Log entry that is formatted only when it's read.
+ *
+ * The entry keeps a format string and copies of arguments, formatting happens in \p str(), \p format_to() or when the
+ * entry is passed to fmt (the formatter is provided). Entries of logs that are dropped are never formatted.
+ * Arguments up to \p inline_size bytes are stored in the entry itself, larger ones are allocated.
+ *
+ * The format string, as well as pointers and views passed as arguments, must outlive the entry. Usually the format
+ * string is a literal, pass strings by value if they are temporary.
+ */
+class FormatEntry {
+public:
+    static constexpr std::size_t inline_size = 4 * sizeof(void *);
+
+    template <class... Args>
+    FormatEntry(fmt::format_string<Args...> f, Args &&...args) // NOLINT
+        : format_(fmt::string_view(f))
+    {
+        using Tuple = std::tuple<std::decay_t<Args>...>;
+        static_assert(std::is_copy_constructible_v<Tuple>, "Arguments of the entry must be copyable");
+
+        if constexpr (fitsInline<Tuple>()) {
+            ::new (static_cast<void *>(storage_)) Tuple(std::forward<Args>(args)...);
+        } else {
+            ::new (static_cast<void *>(storage_)) Tuple *(new Tuple(std::forward<Args>(args)...));
+        }
+        ops_ = &opsFor<Tuple>;
+    }
+
+    FormatEntry(const FormatEntry &other) : format_(other.format_), ops_(other.ops_) {
+        ops_->copy(other.storage_, storage_);
+    }
+
+    FormatEntry(FormatEntry &&other) noexcept : format_(other.format_), ops_(other.ops_) {
+        ops_->move(other.storage_, storage_);
+    }
+
+    FormatEntry &operator=(const FormatEntry &other) {
+        if (this != &other) {
+            FormatEntry tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    FormatEntry &operator=(FormatEntry &&other) noexcept {
+        if (this != &other) {
+            ops_->destroy(storage_);
+            format_ = other.format_;
+            ops_ = other.ops_;
+            ops_->move(other.storage_, storage_);
+        }
+        return *this;
+    }
+
+    ~FormatEntry() { ops_->destroy(storage_); }
+
+    /*!
+     * Format the entry to \p out.
+     */
+    fmt::appender format_to(fmt::appender out) const { return ops_->format(storage_, format_, out); }
+
+    /*!
+     * Format the entry.
+     * @return a formatted string.
+     */
+    [[nodiscard]] std::string str() const {
+        fmt::memory_buffer buffer;
+        format_to(fmt::appender(buffer));
+        return fmt::to_string(buffer);
+    }
+
+    // Entries are equal if they produce the same text
+    friend bool operator==(const FormatEntry &lhs, const FormatEntry &rhs) { return lhs.str() == rhs.str(); }
+
+private:
+    struct Ops {
+        fmt::appender (*format)(const std::byte *, fmt::string_view, fmt::appender);
+        void (*copy)(const std::byte *, std::byte *);
+        void (*move)(std::byte *, std::byte *) noexcept;
+        void (*destroy)(std::byte *) noexcept;
+    };
+
+    template <class Tuple>
+    static constexpr bool fitsInline() {
+        return sizeof(Tuple) <= inline_size && alignof(Tuple) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<Tuple>;
+    }
+
+    template <class Tuple>
+    static const Tuple &get(const std::byte *storage) {
+        if constexpr (fitsInline<Tuple>()) {
+            return *std::launder(reinterpret_cast<const Tuple *>(storage));
+        } else {
+            return **std::launder(reinterpret_cast<Tuple *const *>(storage));
+        }
+    }
+
+    template <class Tuple>
+    static constexpr Ops opsFor = {
+        .format = [](const std::byte *storage, fmt::string_view f, fmt::appender out) {
+            return std::apply([&](const auto &...args) { return fmt::vformat_to(out, f, fmt::make_format_args(args...)); },
+                              get<Tuple>(storage));
+        },
+        .copy = [](const std::byte *from, std::byte *to) {
+            if constexpr (fitsInline<Tuple>()) {
+                ::new (static_cast<void *>(to)) Tuple(get<Tuple>(from));
+            } else {
+                ::new (static_cast<void *>(to)) Tuple *(new Tuple(get<Tuple>(from)));
+            }
+        },
+        .move = [](std::byte *from, std::byte *to) noexcept {
+            if constexpr (fitsInline<Tuple>()) {
+                ::new (static_cast<void *>(to)) Tuple(std::move(*std::launder(reinterpret_cast<Tuple *>(from))));
+            } else {
+                // The source is left empty, destroying it is a no-op
+                auto *&p = *std::launder(reinterpret_cast<Tuple **>(from));
+                ::new (static_cast<void *>(to)) Tuple *(std::exchange(p, nullptr));
+            }
+        },
+        .destroy = [](std::byte *storage) noexcept {
+            if constexpr (fitsInline<Tuple>()) {
+                std::destroy_at(std::launder(reinterpret_cast<Tuple *>(storage)));
+            } else {
+                delete *std::launder(reinterpret_cast<Tuple **>(storage));
+            }
+        },
+    };
+
+    fmt::string_view format_;
+    const Ops *ops_;
+    alignas(std::max_align_t) std::byte storage_[inline_size];
+};
+
+/*!
+ * Log of entries that are formatted only when they are read.
+ */
+using FormatLog = std::vector<FormatEntry>;
+
+/*!
+ * Add a log entry that is formatted later, see \p FormatEntry. For example:
+ * \code{.cpp}
+ *    auto w = fl::tell_fmt(fl::Writer<fl::FormatLog, int>{{}, 42}, "The answer is {}", 42);
+ *    fmt::print("{}\n", fmt::join(w.log(), "\n"));
+ * \endcode
+ *
+ * The entry is not created if the log discards entries.
+ *
+ * @param w a writer, its log must accept \p FormatEntry.
+ * @param f a format string.
+ * @param args arguments to format.
+ * @return a writer with the same value and combined logs.
+ */
+template <concepts::IsWriter W, class... Args>
+auto tell_fmt(W &&w, fmt::format_string<Args...> f, Args &&...args) {
+    return std::forward<W>(w).tell_with([&](const auto &) { return FormatEntry(f, std::forward<Args>(args)...); });
+}
+
+} // namespace fl
+
+template <>
+struct fmt::formatter<fl::FormatEntry> {
+    constexpr auto parse(fmt::format_parse_context &ctx) { return ctx.begin(); }
+
+    auto format(const fl::FormatEntry &e, fmt::format_context &ctx) const { return e.format_to(ctx.out()); }
+};
@@ -0,0 +1,93 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+
+// This header requires {fmt}, it's not included by fl/semigroups/all.hpp
+namespace fl {
+
+namespace details {
+
+template <class V, class T>
+constexpr bool is_memory_buffer = false;
+
+template <class T, std::size_t N, class Allocator>
+constexpr bool is_memory_buffer<fmt::basic_memory_buffer<T, N, Allocator>, T> = true;
+
+} // namespace details
+
+namespace _concepts {
+
+template <class V, class T>
+concept AppendableToMemoryBuffer =
+    std::convertible_to<const std::remove_cvref_t<V> &, fmt::basic_string_view<T>> ||
+    details::is_memory_buffer<std::remove_cvref_t<V>, T>;
+
+} // namespace _concepts
+
+namespace details {
+
+template <class T>
+fmt::basic_string_view<T> bufferView(const auto &v) {
+    if constexpr (is_memory_buffer<std::remove_cvref_t<decltype(v)>, T>) {
+        return {v.data(), v.size()};
+    } else {
+        return fmt::basic_string_view<T>(v);
+    }
+}
+
+template <class T, std::size_t N, class Allocator>
+void appendToBuffer(fmt::basic_memory_buffer<T, N, Allocator> &acc, fmt::basic_string_view<T> v) {
+    acc.append(v.data(), v.data() + v.size());
+}
+
+} // namespace details
+
+/*!
+ * Semigroup for fmt::basic_memory_buffer. The first \p N elements of the buffer are stored inline, so short logs don't
+ * allocate. The buffer can be combined with other buffers and strings.
+ */
+template <class T, std::size_t N, class Allocator>
+struct Semigroup<fmt::basic_memory_buffer<T, N, Allocator>> {
+    using Buffer = fmt::basic_memory_buffer<T, N, Allocator>;
+
+    [[nodiscard]]
+    Buffer combine(concepts::Same<Buffer> auto &&v1, _concepts::AppendableToMemoryBuffer<T> auto &&v2) const {
+        using V1 = decltype(v1);
+        if constexpr (std::is_rvalue_reference_v<V1> && !std::is_const_v<std::remove_reference_t<V1>>) {
+            Buffer result(std::move(v1));
+            details::appendToBuffer(result, details::bufferView<T>(v2));
+            return result;
+        } else {
+            // The buffer is not copyable
+            const auto tail = details::bufferView<T>(v2);
+            Buffer result(v1.get_allocator());
+            result.reserve(v1.size() + tail.size());
+            details::appendToBuffer(result, details::bufferView<T>(v1));
+            details::appendToBuffer(result, tail);
+            return result;
+        }
+    }
+
+    void combine_into(Buffer &acc, _concepts::AppendableToMemoryBuffer<T> auto &&v) const {
+        details::appendToBuffer(acc, details::bufferView<T>(v));
+    }
+};
+
+} // namespace fl
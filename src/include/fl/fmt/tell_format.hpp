@@ -0,0 +1,92 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <fl/concepts/concepts.hpp>
+#include <fl/fmt/semigroup_memory_buffer.hpp>
+#include <fl/writer/writer.hpp>
+
+// This header requires {fmt}, it's not included by fl/writer/all.hpp
+namespace fl {
+
+namespace details {
+
+template <class>
+constexpr bool is_format_target = false;
+
+template <class Traits, class Allocator>
+constexpr bool is_format_target<std::basic_string<char, Traits, Allocator>> = true;
+
+template <std::size_t N, class Allocator>
+constexpr bool is_format_target<fmt::basic_memory_buffer<char, N, Allocator>> = true;
+
+template <class Log, class... Args>
+void formatInto(Log &log, fmt::format_string<Args...> f, Args &&...args) {
+    if constexpr (is_memory_buffer<Log, char>) {
+        fmt::format_to(fmt::appender(log), f, std::forward<Args>(args)...);
+    } else {
+        // Appending through back_inserter resizes the string chunk by chunk, an inline buffer is faster
+        fmt::memory_buffer entry;
+        fmt::format_to(fmt::appender(entry), f, std::forward<Args>(args)...);
+        log.append(entry.data(), entry.size());
+    }
+}
+
+} // namespace details
+
+namespace concepts {
+
+template <class W>
+concept WriterWithFormatTarget = IsWriter<W> && fl::details::is_format_target<typename std::remove_cvref_t<W>::LogType>;
+
+} // namespace concepts
+
+/*!
+ * Format a log entry directly into the log of writer.
+ *
+ * Works for writers with \p std::string and \p fmt::basic_memory_buffer<char> logs. Unlike
+ * \p w.tell(fmt::format(...)), no temporary string is allocated: entries are formatted straight into memory buffers,
+ * and via an inline buffer into strings. Rvalue writers are formatted in place, lvalue writers are copied first.
+ * For example:
+ * \code{.cpp}
+ *    auto w = fl::tell_format(fl::Writer<fmt::memory_buffer, int>{{}, 42}, "The answer is {}\n", 42);
+ * \endcode
+ *
+ * @param w a writer.
+ * @param f a format string.
+ * @param args arguments to format.
+ * @return a writer with the same value and the formatted entry appended to the log.
+ */
+template <concepts::WriterWithFormatTarget W, class... Args>
+auto tell_format(W &&w, fmt::format_string<Args...> f, Args &&...args) {
+    using WriterType = std::remove_cvref_t<W>;
+    using LogType = typename WriterType::LogType;
+
+    WriterType result = [&]() -> WriterType {
+        if constexpr (std::is_rvalue_reference_v<W &&> && !std::is_const_v<std::remove_reference_t<W>>) {
+            return std::move(w);
+        } else {
+            return WriterType{Semigroup<LogType>().combine(w.log_, LogType{}), w.value_};
+        }
+    }();
+
+    details::formatInto(result.log_, f, std::forward<Args>(args)...);
+
+    return result;
+}
+
+} // namespace fl
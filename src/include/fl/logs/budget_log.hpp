@@ -0,0 +1,167 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <deque>
+#include <string>
+#include <algorithm>
+#include <concepts>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace fl {
+
+/*!
+ * The number of bytes an entry takes: the size of the object and the size of its elements, e.g. characters of
+ * a string.
+ */
+struct EntryBytes {
+    template <class T>
+    [[nodiscard]]
+    constexpr std::size_t operator()(const T &entry) const noexcept {
+        if constexpr (requires { typename T::value_type; entry.size(); }) {
+            return sizeof(T) + entry.size() * sizeof(typename T::value_type);
+        } else {
+            return sizeof(T);
+        }
+    }
+};
+
+/*!
+ * Log that takes at most \p Budget bytes, the oldest entries are dropped to fit new ones.
+ *
+ * An entry that doesn't fit into the budget by itself is dropped.
+ *
+ * @tparam Budget the maximal number of bytes.
+ * @tparam T the type of entries.
+ * @tparam Bytes the function that returns the number of bytes an entry takes.
+ */
+template <std::size_t Budget, class T = std::string, class Bytes = EntryBytes>
+class BudgetLog {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = typename std::deque<T>::const_iterator;
+
+    static constexpr size_type budget = Budget;
+
+    BudgetLog() = default;
+
+    BudgetLog(std::initializer_list<T> entries) {
+        for (const auto &e : entries) {
+            push_back(e);
+        }
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    template <class... Args>
+    void emplace_back(Args &&...args) {
+        T entry(std::forward<Args>(args)...);
+        const auto bytes = Bytes()(entry);
+        if (bytes > Budget) {
+            ++dropped_;
+            return;
+        }
+
+        makeRoom(bytes);
+        entries_.push_back(std::move(entry));
+        bytes_ += bytes;
+    }
+
+    /*!
+     * Append entries of \p other. Entries of \p other that would be dropped right away are not copied.
+     */
+    template <class L>
+    requires std::same_as<std::remove_cvref_t<L>, BudgetLog>
+    BudgetLog &append(L &&other) {
+        if (this == &other) {
+            return append(BudgetLog(other));
+        }
+
+        if constexpr (std::is_same_v<L &&, BudgetLog &&>) {
+            if (empty()) {
+                const auto dropped = dropped_;
+                *this = std::move(other);
+                dropped_ += dropped;
+                return *this;
+            }
+        }
+
+        // The newest entries of other that fit into the budget together
+        auto first = other.entries_.size();
+        for (size_type bytes = 0; first > 0; --first) {
+            bytes += Bytes()(other.entries_[first - 1]);
+            if (bytes > Budget) {
+                break;
+            }
+        }
+
+        dropped_ += other.dropped_ + first;
+        for (auto i = first; i < other.entries_.size(); ++i) {
+            const auto bytes = Bytes()(other.entries_[i]);
+            makeRoom(bytes);
+            if constexpr (std::is_same_v<L &&, BudgetLog &&>) {
+                entries_.push_back(std::move(other.entries_[i]));
+            } else {
+                entries_.push_back(other.entries_[i]);
+            }
+            bytes_ += bytes;
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return entries_.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+    /*!
+     * The number of bytes taken by entries, never exceeds \p Budget.
+     */
+    [[nodiscard]] size_type bytes() const noexcept { return bytes_; }
+
+    /*!
+     * The number of entries dropped because of the budget.
+     */
+    [[nodiscard]] size_type dropped() const noexcept { return dropped_; }
+
+    [[nodiscard]] const T &operator[](size_type i) const noexcept { return entries_[i]; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return entries_.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return entries_.end(); }
+
+    void clear() noexcept {
+        entries_.clear();
+        bytes_ = 0;
+        dropped_ = 0;
+    }
+
+    friend bool operator==(const BudgetLog &lhs, const BudgetLog &rhs) { return lhs.entries_ == rhs.entries_; }
+
+private:
+    void makeRoom(size_type bytes) {
+        while (bytes_ + bytes > Budget) {
+            bytes_ -= Bytes()(entries_.front());
+            entries_.pop_front();
+            ++dropped_;
+        }
+    }
+
+    std::deque<T> entries_;
+    size_type bytes_ = 0;
+    size_type dropped_ = 0;
+};
+
+} // namespace fl
@@ -0,0 +1,201 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <list>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace fl {
+
+/*!
+ * Log made of contiguous chunks.
+ *
+ * Entries are pushed into the last chunk until it holds \p ChunkSize elements. Appending another rvalue log splices
+ * its chunks in O(1), so entries are never moved again once they are in the log. Small leading chunks of the
+ * appended log are merged into the last chunk to keep the number of chunks low.
+ *
+ * Iteration over chunks (see \p chunks()) visits contiguous memory, element iterators are also available.
+ *
+ * @tparam T the type of log entries.
+ * @tparam ChunkSize the maximal number of entries in a chunk.
+ */
+template <class T, std::size_t ChunkSize = 64>
+class ChunkedLog {
+    static_assert(ChunkSize > 0);
+
+    template <bool Const>
+    class Iterator;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using Chunk = std::vector<T>;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    static constexpr size_type chunk_size = ChunkSize;
+
+    ChunkedLog() = default;
+
+    ChunkedLog(std::initializer_list<T> entries) {
+        for (const auto &e : entries) {
+            push_back(e);
+        }
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    template <class... Args>
+    reference emplace_back(Args &&...args) {
+        if (chunks_.empty() || chunks_.back().size() >= ChunkSize) {
+            chunks_.emplace_back();
+        }
+
+        auto &r = chunks_.back().emplace_back(std::forward<Args>(args)...);
+        ++size_;
+
+        return r;
+    }
+
+    /*!
+     * Append entries of another log. Chunks of rvalue logs are spliced, entries of lvalue logs are copied.
+     */
+    ChunkedLog &append(ChunkedLog &&other) {
+        if (&other == this) {
+            return append(ChunkedLog(other));
+        }
+
+        if (!other.chunks_.empty() && !chunks_.empty()) {
+            auto &back = chunks_.back();
+            auto &front = other.chunks_.front();
+            if (back.size() + front.size() <= ChunkSize) {
+                std::move(front.begin(), front.end(), std::back_inserter(back));
+                other.chunks_.pop_front();
+            }
+        }
+
+        chunks_.splice(chunks_.end(), other.chunks_);
+        size_ += std::exchange(other.size_, 0);
+
+        return *this;
+    }
+
+    ChunkedLog &append(const ChunkedLog &other) {
+        if (&other == this) {
+            return append(ChunkedLog(other));
+        }
+
+        for (const auto &chunk : other.chunks_) {
+            for (const auto &e : chunk) {
+                push_back(e);
+            }
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    [[nodiscard]] size_type max_size() const noexcept { return Chunk().max_size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /*!
+     * Contiguous chunks of entries in order.
+     */
+    [[nodiscard]] const std::list<Chunk> &chunks() const noexcept { return chunks_; }
+
+    void clear() noexcept {
+        chunks_.clear();
+        size_ = 0;
+    }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(chunks_.begin(), chunks_.end()); }
+    [[nodiscard]] iterator end() noexcept { return iterator(chunks_.end(), chunks_.end()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return const_iterator(chunks_.cbegin(), chunks_.cend()); }
+    [[nodiscard]] const_iterator cend() const noexcept { return const_iterator(chunks_.cend(), chunks_.cend()); }
+
+    friend bool operator==(const ChunkedLog &lhs, const ChunkedLog &rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+private:
+    template <bool Const>
+    class Iterator {
+        using ChunkIterator =
+            std::conditional_t<Const, typename std::list<Chunk>::const_iterator, typename std::list<Chunk>::iterator>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        Iterator() = default;
+
+        Iterator(ChunkIterator chunk, ChunkIterator end) : chunk_(chunk), end_(end) { skipEmpty(); }
+
+        operator Iterator<true>() const requires (!Const) { return Iterator<true>(chunk_, end_, index_); } // NOLINT
+
+        reference operator*() const { return (*chunk_)[index_]; }
+        pointer operator->() const { return &(*chunk_)[index_]; }
+
+        Iterator &operator++() {
+            if (++index_ == chunk_->size()) {
+                ++chunk_;
+                index_ = 0;
+                skipEmpty();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator &other) const { return chunk_ == other.chunk_ && index_ == other.index_; }
+
+    private:
+        friend class Iterator<!Const>;
+
+        Iterator(ChunkIterator chunk, ChunkIterator end, std::size_t index) : chunk_(chunk), end_(end), index_(index) {}
+
+        void skipEmpty() {
+            while (chunk_ != end_ && chunk_->empty()) {
+                ++chunk_;
+            }
+        }
+
+        ChunkIterator chunk_{};
+        ChunkIterator end_{};
+        std::size_t index_ = 0;
+    };
+
+    std::list<Chunk> chunks_;
+    size_type size_ = 0;
+};
+
+} // namespace fl
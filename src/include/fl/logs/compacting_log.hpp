@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <fl/concepts/concepts.hpp>
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/utils/attributes.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class V, class Compacting>
+concept AppendableToCompactingLog =
+    concepts::Same<V, Compacting> ||
+    concepts::CombinableInto<Semigroup<typename Compacting::LogType>, typename Compacting::LogType, V> ||
+    concepts::details::CombinableWithValue<Semigroup<typename Compacting::LogType>, typename Compacting::LogType, V>;
+
+} // namespace _concepts
+
+/*!
+ * Log that invokes a user callback when it grows beyond \p Threshold entries.
+ *
+ * The callback gets the underlying log by reference and is expected to make it smaller, e.g. aggregate or summarize
+ * old entries, or move them to a file. It's invoked after every append that leaves more than \p Threshold entries,
+ * so a callback that brings the size down to \p Threshold keeps the log bounded.
+ *
+ * \code{.cpp}
+ *    struct KeepLast {
+ *        void operator()(std::vector<std::string> &log) const { log.erase(log.begin(), log.end() - 100); }
+ *    };
+ *    using Log = fl::CompactingLog<std::vector<std::string>, KeepLast, 1000>;
+ * \endcode
+ *
+ * @tparam Log the underlying log, \p Semigroup<Log> must exist.
+ * @tparam Compactor the callback, it's default constructed and invoked with \p Log&.
+ * @tparam Threshold the number of entries that triggers the callback.
+ */
+template <class Log, class Compactor, std::size_t Threshold>
+requires std::default_initializable<Compactor> && std::invocable<const Compactor &, Log &>
+class CompactingLog {
+public:
+    using LogType = Log;
+    using value_type = typename Log::value_type;
+    using size_type = std::size_t;
+
+    static constexpr size_type threshold = Threshold;
+
+    CompactingLog() = default;
+
+    CompactingLog(Log log) : log_(std::move(log)) { compactIfNeeded(); } // NOLINT
+
+    CompactingLog(std::initializer_list<value_type> entries) : CompactingLog(Log(entries)) {}
+
+    /*!
+     * Append \p v, which is either another compacting log, or anything \p Semigroup<Log> can combine with \p Log.
+     */
+    template <_concepts::AppendableToCompactingLog<CompactingLog> V>
+    CompactingLog &append(V &&v) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<V>, CompactingLog>) {
+            compactions_ += v.compactions_;
+            combine_into(Semigroup<Log>(), log_, std::forward<V>(v).log_);
+        } else {
+            combine_into(Semigroup<Log>(), log_, std::forward<V>(v));
+        }
+        compactIfNeeded();
+
+        return *this;
+    }
+
+    [[nodiscard]] const Log &log() const & noexcept { return log_; }
+
+    [[nodiscard]] Log log() && noexcept { return std::move(log_); }
+
+    [[nodiscard]] size_type size() const noexcept { return std::size(log_); }
+
+    [[nodiscard]] bool empty() const noexcept { return std::empty(log_); }
+
+    /*!
+     * The number of times the callback has been invoked, including compactions of appended logs.
+     */
+    [[nodiscard]] size_type compactions() const noexcept { return compactions_; }
+
+    [[nodiscard]] auto begin() const noexcept { return std::begin(log_); }
+    [[nodiscard]] auto end() const noexcept { return std::end(log_); }
+
+    friend bool operator==(const CompactingLog &lhs, const CompactingLog &rhs) { return lhs.log_ == rhs.log_; }
+
+private:
+    void compactIfNeeded() {
+        if (size() > Threshold) {
+            std::invoke(compactor_, log_);
+            ++compactions_;
+        }
+    }
+
+    Log log_;
+    size_type compactions_ = 0;
+    FL_NO_UNIQUE_ADDRESS Compactor compactor_;
+};
+
+} // namespace fl
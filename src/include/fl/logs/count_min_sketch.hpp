@@ -0,0 +1,143 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fl/semigroups/semigroup_elementwise.hpp>
+#include <fl/utils/attributes.hpp>
+#include <fl/utils/hash.hpp>
+
+namespace fl {
+
+/*!
+ * Estimate of the number of occurrences of each entry, e.g. the most frequent error codes.
+ *
+ * Every entry increments one counter in each of \p Depth rows of \p Width counters. The estimate is the minimum of
+ * these counters, so it never underestimates, and it overestimates by at most e / Width of the total with probability
+ * 1 - e^-Depth. Sketches are merged with an element-wise addition.
+ *
+ * The Width * Depth counters are allocated by the first \p add. A sketch that is only merged into takes over the
+ * counters of the first non-empty sketch, so the total of all workers can start from an empty sketch.
+ *
+ * @tparam T the type of entries.
+ * @tparam Width the number of counters in a row.
+ * @tparam Depth the number of rows.
+ * @tparam Count the type of counters.
+ * @tparam Hash the hash of entries.
+ */
+template <class T, std::size_t Width = 2048, std::size_t Depth = 4, class Count = std::uint64_t,
+          class Hash = std::hash<T>>
+requires (Width > 0 && Depth > 0)
+class CountMinSketch {
+public:
+    using value_type = T;
+    using count_type = Count;
+    using size_type = std::size_t;
+
+    static constexpr size_type width = Width;
+    static constexpr size_type depth = Depth;
+
+    CountMinSketch() = default;
+
+    template <class E>
+    requires std::invocable<const Hash &, const E &>
+    CountMinSketch &add(const E &entry, Count count = Count(1)) {
+        if (counters_.empty()) {
+            counters_.resize(Width * Depth);
+        }
+
+        const auto h = hashOf(entry);
+        for (size_type row = 0; row < Depth; ++row) {
+            counters_[cell(h, row)] += count;
+        }
+        total_ += count;
+
+        return *this;
+    }
+
+    template <class S>
+    requires std::same_as<std::remove_cvref_t<S>, CountMinSketch>
+    CountMinSketch &merge(S &&other) {
+        if (other.counters_.empty()) {
+            return *this;
+        }
+
+        total_ += other.total_;
+        if (counters_.empty()) {
+            counters_ = std::forward<S>(other).counters_;
+        } else {
+            details::addElementwise(counters_.data(), other.counters_.data(), counters_.size());
+        }
+
+        return *this;
+    }
+
+    /*!
+     * The estimated number of occurrences of \p entry, it's never less than the exact one.
+     */
+    template <class E>
+    requires std::invocable<const Hash &, const E &>
+    [[nodiscard]]
+    Count estimate(const E &entry) const {
+        if (counters_.empty()) {
+            return Count(0);
+        }
+
+        const auto h = hashOf(entry);
+        auto result = std::numeric_limits<Count>::max();
+        for (size_type row = 0; row < Depth; ++row) {
+            result = std::min(result, counters_[cell(h, row)]);
+        }
+
+        return result;
+    }
+
+    /*!
+     * The number of added entries.
+     */
+    [[nodiscard]] Count total() const noexcept { return total_; }
+
+    [[nodiscard]] bool empty() const noexcept { return total_ == 0; }
+
+    friend bool operator==(const CountMinSketch &lhs, const CountMinSketch &rhs) {
+        // Counters are allocated unless sketches are empty
+        return lhs.total_ == rhs.total_ && (lhs.total_ == 0 || lhs.counters_ == rhs.counters_);
+    }
+
+private:
+    template <class E>
+    [[nodiscard]]
+    std::uint64_t hashOf(const E &entry) const {
+        return details::mixHash(static_cast<std::uint64_t>(hash_(entry)));
+    }
+
+    // Rows use independent-enough hashes derived from two halves of one hash
+    [[nodiscard]]
+    static size_type cell(std::uint64_t h, size_type row) noexcept {
+        const auto h1 = h & 0xffffffffu;
+        const auto h2 = (h >> 32) | 1u;
+        return row * Width + static_cast<size_type>((h1 + row * h2) % Width);
+    }
+
+    std::vector<Count> counters_;
+    Count total_ = 0;
+    FL_NO_UNIQUE_ADDRESS Hash hash_;
+};
+
+} // namespace fl
@@ -0,0 +1,186 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <initializer_list>
+#include <utility>
+
+namespace fl {
+
+/*!
+ * Log of strings stored in a single character buffer.
+ *
+ * Entries are kept back to back in one buffer, offsets of entries are kept in another one. Unlike
+ * std::vector<std::string>, long entries don't need a heap block each, and appending a log copies both buffers in
+ * bulk instead of moving strings one by one. Entries are read as std::string_view, which stay valid until the log is
+ * modified.
+ */
+class FlatStringLog {
+public:
+    class const_iterator;
+
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::string_view;
+    using const_reference = std::string_view;
+    using iterator = const_iterator;
+
+    FlatStringLog() = default;
+
+    FlatStringLog(std::initializer_list<std::string_view> entries) {
+        for (auto e : entries) {
+            push_back(e);
+        }
+    }
+
+    void push_back(std::string_view entry) {
+        if (offsets_.empty()) {
+            offsets_.push_back(0);
+        }
+        chars_.append(entry);
+        offsets_.push_back(chars_.size());
+    }
+
+    /*!
+     * Append entries of another log. Characters are copied at once, offsets are shifted by the current size.
+     */
+    FlatStringLog &append(const FlatStringLog &other) {
+        if (this == &other) {
+            return append(FlatStringLog(other));
+        }
+
+        if (other.empty()) {
+            return *this;
+        }
+        if (offsets_.empty()) {
+            offsets_.push_back(0);
+        }
+
+        const auto base = chars_.size();
+        chars_.append(other.chars_);
+
+        const auto count = offsets_.size();
+        offsets_.resize(count + other.size());
+        std::transform(std::next(other.offsets_.begin()), other.offsets_.end(),
+                       offsets_.begin() + difference_type(count), [base](size_type end) { return end + base; });
+
+        return *this;
+    }
+
+    FlatStringLog &append(FlatStringLog &&other) {
+        if (empty() && chars_.capacity() <= other.chars_.capacity()) {
+            return *this = std::move(other);
+        }
+
+        return append(std::as_const(other));
+    }
+
+    /*!
+     * Reserve space for \p entries entries with \p chars characters in total.
+     */
+    void reserve(size_type entries, size_type chars) {
+        offsets_.reserve(entries + 1);
+        chars_.reserve(chars);
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    [[nodiscard]] size_type max_size() const noexcept { return offsets_.max_size() - 1; }
+
+    [[nodiscard]] bool empty() const noexcept { return offsets_.size() < 2; }
+
+    /*!
+     * The total number of characters of all entries.
+     */
+    [[nodiscard]] size_type chars_size() const noexcept { return chars_.size(); }
+
+    /*!
+     * All entries without separators. Can be used for draining the log at once.
+     */
+    [[nodiscard]] std::string_view chars() const noexcept { return chars_; }
+
+    [[nodiscard]] std::string_view operator[](size_type i) const noexcept { return begin()[difference_type(i)]; }
+
+    [[nodiscard]] std::string_view front() const noexcept { return (*this)[0]; }
+    [[nodiscard]] std::string_view back() const noexcept { return (*this)[size() - 1]; }
+
+    void clear() noexcept {
+        chars_.clear();
+        offsets_.clear();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return {chars_.data(), offsets_.data()}; }
+    [[nodiscard]] const_iterator end() const noexcept { return {chars_.data(), offsets_.data() + size()}; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    friend bool operator==(const FlatStringLog &lhs, const FlatStringLog &rhs) noexcept {
+        return lhs.chars_ == rhs.chars_ && (lhs.empty() ? rhs.empty() : lhs.offsets_ == rhs.offsets_);
+    }
+
+    class const_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+
+        reference operator*() const noexcept { return {chars_ + offset_[0], offset_[1] - offset_[0]}; }
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        const_iterator &operator++() noexcept { ++offset_; return *this; }
+        const_iterator &operator--() noexcept { --offset_; return *this; }
+        const_iterator operator++(int) noexcept { auto tmp = *this; ++offset_; return tmp; }
+        const_iterator operator--(int) noexcept { auto tmp = *this; --offset_; return tmp; }
+
+        const_iterator &operator+=(difference_type n) noexcept { offset_ += n; return *this; }
+        const_iterator &operator-=(difference_type n) noexcept { return *this += -n; }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) noexcept {
+            return lhs.offset_ - rhs.offset_;
+        }
+
+        friend bool operator==(const const_iterator &lhs, const const_iterator &rhs) noexcept {
+            return lhs.offset_ == rhs.offset_;
+        }
+        friend auto operator<=>(const const_iterator &lhs, const const_iterator &rhs) noexcept {
+            return lhs.offset_ <=> rhs.offset_;
+        }
+
+    private:
+        friend class FlatStringLog;
+
+        const_iterator(const char *chars, const size_type *offset) : chars_(chars), offset_(offset) {}
+
+        const char *chars_ = nullptr;
+        const size_type *offset_ = nullptr;
+    };
+
+private:
+    std::string chars_;
+    // Entry i is [offsets_[i], offsets_[i + 1]), the leading zero is added with the first entry
+    std::vector<size_type> offsets_;
+};
+
+} // namespace fl
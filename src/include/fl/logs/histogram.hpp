@@ -0,0 +1,266 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <valarray>
+
+#include <fl/semigroups/semigroup_elementwise.hpp>
+
+namespace fl {
+
+namespace details {
+
+// The smallest rank that covers the quantile q of total values, ranks start from 1
+template <class Count>
+[[nodiscard]]
+constexpr Count quantileRank(double q, Count total) noexcept {
+    const auto rank = static_cast<Count>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total)));
+    return std::max(rank, Count(1));
+}
+
+} // namespace details
+
+/*!
+ * Histogram with \p N buckets of equal width over [\p Min, \p Max), e.g. latencies in microseconds:
+ * \code{.cpp}
+ *    using Latency = fl::Histogram<0, 10'000, 100>;
+ *    auto w = fl::Writer<Latency, Response>{}.tell(elapsed.count());
+ * \endcode
+ *
+ * Values below \p Min are counted in the first bucket and values from \p Max in the last one. Buckets are stored in
+ * std::array, so merging histograms is an element-wise addition without allocations. Moving a histogram copies all
+ * buckets though, so long writer chains are faster with a few buckets or with \p HdrHistogram.
+ *
+ * @tparam Min the lower bound of values.
+ * @tparam Max the upper bound of values, for integers (Max - Min) * N must fit into the type of values.
+ * @tparam N the number of buckets.
+ * @tparam Count the type of counters.
+ */
+template <auto Min, auto Max, std::size_t N, class Count = std::uint64_t>
+requires (N > 0 && Min < Max)
+class Histogram {
+public:
+    using value_type = std::common_type_t<decltype(Min), decltype(Max)>;
+    using count_type = Count;
+    using Buckets = std::array<Count, N>;
+
+    static constexpr std::size_t bucket_count = N;
+
+    static_assert(!std::is_integral_v<value_type> ||
+                  value_type(Max - Min) <= std::numeric_limits<value_type>::max() / value_type(N));
+
+    constexpr Histogram() = default;
+
+    constexpr Histogram &record(value_type value, Count count = Count(1)) noexcept {
+        buckets_[bucket_of(value)] += count;
+        total_ += count;
+        return *this;
+    }
+
+    constexpr Histogram &merge(const Histogram &other) noexcept {
+        Semigroup<Buckets>().combine_into(buckets_, other.buckets_);
+        total_ += other.total_;
+        return *this;
+    }
+
+    /*!
+     * The index of the bucket for \p value.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t bucket_of(value_type value) noexcept {
+        if (!(value > value_type(Min))) {
+            return 0;
+        }
+        if (!(value < value_type(Max))) {
+            return N - 1;
+        }
+
+        const auto index = static_cast<std::size_t>((value - value_type(Min)) * value_type(N) / range);
+        return std::min(index, N - 1);
+    }
+
+    /*!
+     * The smallest value counted in the bucket \p i, except values below \p Min that are counted in the first bucket.
+     */
+    [[nodiscard]]
+    static constexpr value_type lower_bound(std::size_t i) noexcept {
+        if constexpr (std::is_integral_v<value_type>) {
+            return value_type(Min) + (value_type(i) * range + value_type(N) - 1) / value_type(N);
+        } else {
+            return value_type(Min) + range * value_type(i) / value_type(N);
+        }
+    }
+
+    /*!
+     * The lower bound of the bucket that contains the quantile \p q of values, \p Min if there are no values.
+     */
+    [[nodiscard]]
+    constexpr value_type value_at_quantile(double q) const noexcept {
+        if (total_ == 0) {
+            return value_type(Min);
+        }
+
+        const auto rank = details::quantileRank(q, total_);
+        Count seen = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) {
+                return lower_bound(i);
+            }
+        }
+        return lower_bound(N - 1);
+    }
+
+    [[nodiscard]] constexpr const Buckets &buckets() const noexcept { return buckets_; }
+
+    [[nodiscard]] constexpr Count total() const noexcept { return total_; }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return total_ == 0; }
+
+    constexpr bool operator==(const Histogram &) const = default;
+
+private:
+    static constexpr value_type range = value_type(Max) - value_type(Min);
+
+    Buckets buckets_{};
+    Count total_ = 0;
+};
+
+/*!
+ * Histogram of non-negative integers with bounded relative error, e.g. latencies in nanoseconds.
+ *
+ * Values below 2^SubBucketBits are counted exactly. Larger values are grouped by their highest bit, and each group is
+ * split into 2^SubBucketBits buckets of equal width, so the relative error is at most 2^-SubBucketBits. The same
+ * layout is used by HDR histograms.
+ *
+ * The default layout has 1408 buckets, 11 KiB of counters. They are allocated by the first \p record, so writers that
+ * never record a value don't pay for them. Histograms are merged with an element-wise addition, and merging into an
+ * empty histogram copies or moves the buckets of the other one.
+ *
+ * @tparam SubBucketBits the precision, the relative error is at most 2^-SubBucketBits.
+ * @tparam MaxBits values from 2^MaxBits are counted in the last bucket.
+ * @tparam Count the type of counters.
+ */
+template <std::size_t SubBucketBits = 5, std::size_t MaxBits = 48, class Count = std::uint64_t>
+requires (SubBucketBits < MaxBits && MaxBits <= 64)
+class HdrHistogram {
+public:
+    using value_type = std::uint64_t;
+    using count_type = Count;
+    using Buckets = std::valarray<Count>;
+
+    static constexpr std::size_t bucket_count = (MaxBits - SubBucketBits + 1) << SubBucketBits;
+
+    static constexpr value_type max_value =
+        MaxBits == 64 ? std::numeric_limits<value_type>::max() : (value_type(1) << MaxBits) - 1;
+
+    HdrHistogram() = default;
+
+    HdrHistogram &record(value_type value, Count count = Count(1)) {
+        if (buckets_.size() == 0) {
+            buckets_.resize(bucket_count);
+        }
+
+        buckets_[bucket_of(value)] += count;
+        total_ += count;
+        return *this;
+    }
+
+    template <class H>
+    requires std::same_as<std::remove_cvref_t<H>, HdrHistogram>
+    HdrHistogram &merge(H &&other) {
+        total_ += other.total_;
+        Semigroup<Buckets>().combine_into(buckets_, std::forward<H>(other).buckets_);
+        return *this;
+    }
+
+    /*!
+     * The index of the bucket for \p value.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t bucket_of(value_type value) noexcept {
+        value = std::min(value, max_value);
+        if (value < sub_bucket_count) {
+            return static_cast<std::size_t>(value);
+        }
+
+        const auto shift = static_cast<std::size_t>(std::bit_width(value)) - 1 - SubBucketBits;
+        return (shift << SubBucketBits) + static_cast<std::size_t>(value >> shift);
+    }
+
+    /*!
+     * The smallest value counted in the bucket \p i.
+     */
+    [[nodiscard]]
+    static constexpr value_type lower_bound(std::size_t i) noexcept {
+        if (i < sub_bucket_count) {
+            return i;
+        }
+
+        const auto shift = (i >> SubBucketBits) - 1;
+        return value_type(i - (shift << SubBucketBits)) << shift;
+    }
+
+    /*!
+     * The lower bound of the bucket that contains the quantile \p q of values, 0 if there are no values.
+     */
+    [[nodiscard]]
+    value_type value_at_quantile(double q) const noexcept {
+        if (total_ == 0) {
+            return 0;
+        }
+
+        const auto rank = details::quantileRank(q, total_);
+        Count seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) {
+                return lower_bound(i);
+            }
+        }
+        return lower_bound(bucket_count - 1);
+    }
+
+    /*!
+     * Counters of buckets, empty if nothing has been recorded yet.
+     */
+    [[nodiscard]] const Buckets &buckets() const noexcept { return buckets_; }
+
+    [[nodiscard]] Count total() const noexcept { return total_; }
+
+    [[nodiscard]] bool empty() const noexcept { return total_ == 0; }
+
+    friend bool operator==(const HdrHistogram &lhs, const HdrHistogram &rhs) {
+        if (lhs.total_ != rhs.total_) {
+            return false;
+        }
+        // Both histograms have buckets unless they are empty
+        if (lhs.total_ == 0) {
+            return true;
+        }
+        return std::equal(std::begin(lhs.buckets_), std::end(lhs.buckets_), std::begin(rhs.buckets_));
+    }
+
+private:
+    static constexpr value_type sub_bucket_count = value_type(1) << SubBucketBits;
+
+    Buckets buckets_;
+    Count total_ = 0;
+};
+
+} // namespace fl
@@ -0,0 +1,177 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fl/utils/attributes.hpp>
+#include <fl/utils/hash.hpp>
+
+namespace fl {
+
+namespace details {
+
+// The same blocked loop as addElementwise: GCC compiles each block of 64 registers into unsigned byte maximums of
+// vector registers at -O2 and -O3. The number of registers is a power of two, so from Precision 6 there is no tail.
+inline void maxElementwise(std::uint8_t *FL_RESTRICT acc, const std::uint8_t *FL_RESTRICT v,
+                           std::size_t size) noexcept {
+    constexpr std::size_t block = 64;
+
+    std::size_t i = 0;
+    for (; i + block <= size; i += block) {
+        for (std::size_t j = 0; j < block; ++j) {
+            acc[i + j] = std::max(acc[i + j], v[i + j]);
+        }
+    }
+    for (; i < size; ++i) {
+        acc[i] = std::max(acc[i], v[i]);
+    }
+}
+
+} // namespace details
+
+/*!
+ * Estimate of the number of distinct entries, e.g. unique users seen by a request handler.
+ *
+ * The sketch takes 2^Precision bytes regardless of the number of entries, the standard error of the estimate is about
+ * 1.04 / sqrt(2^Precision), i.e. 1.6% for the default precision. Sketches are merged with a register-wise maximum, so
+ * the result is the same as if all entries were added to one sketch.
+ *
+ * A sketch that has seen no entries holds no registers, and merging into it takes over the registers of the other
+ * sketch.
+ *
+ * @tparam T the type of entries.
+ * @tparam Precision the number of bits that select a register, from 4 to 18.
+ * @tparam Hash the hash of entries.
+ */
+template <class T, std::size_t Precision = 12, class Hash = std::hash<T>>
+requires (Precision >= 4 && Precision <= 18)
+class HyperLogLog {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type register_count = size_type(1) << Precision;
+
+    HyperLogLog() = default;
+
+    template <class E>
+    requires std::invocable<const Hash &, const E &>
+    HyperLogLog &add(const E &entry) {
+        if (registers_.empty()) {
+            registers_.resize(register_count);
+        }
+
+        const auto h = details::mixHash(static_cast<std::uint64_t>(hash_(entry)));
+        const auto index = static_cast<size_type>(h >> (64 - Precision));
+        // The guard bit limits the rank when the remaining bits are zeros
+        const auto rest = (h << Precision) | (std::uint64_t(1) << (Precision - 1));
+        const auto rank = static_cast<std::uint8_t>(std::countl_zero(rest) + 1);
+        registers_[index] = std::max(registers_[index], rank);
+
+        return *this;
+    }
+
+    template <class S>
+    requires std::same_as<std::remove_cvref_t<S>, HyperLogLog>
+    HyperLogLog &merge(S &&other) {
+        if (other.registers_.empty() || &other == this) {
+            return *this;
+        }
+
+        if (registers_.empty()) {
+            registers_ = std::forward<S>(other).registers_;
+        } else {
+            details::maxElementwise(registers_.data(), other.registers_.data(), register_count);
+        }
+
+        return *this;
+    }
+
+    /*!
+     * The estimated number of distinct entries.
+     */
+    [[nodiscard]]
+    double estimate() const noexcept {
+        if (registers_.empty()) {
+            return 0.0;
+        }
+
+        constexpr auto m = static_cast<double>(register_count);
+        double sum = 0.0;
+        size_type zeros = 0;
+        for (auto r : registers_) {
+            sum += inverse_powers[r];
+            zeros += r == 0;
+        }
+
+        const double raw = alpha() * m * m / sum;
+        // Linear counting is more accurate for small cardinalities
+        if (raw <= 2.5 * m && zeros != 0) {
+            return m * std::log(m / static_cast<double>(zeros));
+        }
+
+        return raw;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return registers_.empty(); }
+
+    /*!
+     * Registers of the sketch, empty if nothing has been added yet.
+     */
+    [[nodiscard]] const std::vector<std::uint8_t> &registers() const noexcept { return registers_; }
+
+    friend bool operator==(const HyperLogLog &lhs, const HyperLogLog &rhs) {
+        if (lhs.registers_.size() == rhs.registers_.size()) {
+            return lhs.registers_ == rhs.registers_;
+        }
+
+        // An empty sketch is equal to a sketch with zero registers
+        const auto &registers = lhs.registers_.empty() ? rhs.registers_ : lhs.registers_;
+        return std::all_of(registers.begin(), registers.end(), [](auto r) { return r == 0; });
+    }
+
+private:
+    // 2^-r for every possible rank, computing them is slower than the rest of the estimate
+    static constexpr auto inverse_powers = [] {
+        std::array<double, 66 - Precision> result{};
+        double p = 1.0;
+        for (auto &v : result) {
+            v = p;
+            p /= 2.0;
+        }
+        return result;
+    }();
+
+    [[nodiscard]]
+    static constexpr double alpha() noexcept {
+        switch (register_count) {
+            case 16: return 0.673;
+            case 32: return 0.697;
+            case 64: return 0.709;
+            default: return 0.7213 / (1.0 + 1.079 / static_cast<double>(register_count));
+        }
+    }
+
+    std::vector<std::uint8_t> registers_;
+    FL_NO_UNIQUE_ADDRESS Hash hash_;
+};
+
+} // namespace fl
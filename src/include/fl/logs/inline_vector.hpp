@@ -0,0 +1,307 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <concepts>
+#include <exception>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include <fl/utils/attributes.hpp>
+
+namespace fl {
+
+/*!
+ * What inline vectors do with entries that don't fit into their capacity.
+ */
+namespace overflow {
+
+/*!
+ * Entries are discarded, the number of discarded entries is available with \p dropped().
+ */
+struct Drop {};
+
+/*!
+ * std::terminate is called.
+ */
+struct Terminate {};
+
+/*!
+ * All entries are moved to the heap, the vector grows like std::vector from then on.
+ */
+struct Spill {};
+
+} // namespace overflow
+
+/*!
+ * Vector that keeps up to \p N entries in place, so short-lived logs never allocate.
+ *
+ * Entries live in a std::array, so \p T must be default constructible. Elements past \p size() hold
+ * default-constructed values, which keeps the vector usable in constant expressions.
+ *
+ * @tparam T the type of entries.
+ * @tparam N the number of entries stored in place.
+ * @tparam Overflow the overflow policy, see \p fl::overflow.
+ */
+template <class T, std::size_t N, class Overflow>
+class InlineVector {
+    static_assert(N > 0);
+    static_assert(std::default_initializable<T>, "Inline storage needs default constructible entries");
+
+    static constexpr bool spills = std::is_same_v<Overflow, overflow::Spill>;
+
+    struct NoHeap {};
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using OverflowPolicy = Overflow;
+
+    static constexpr size_type inline_capacity = N;
+
+    constexpr InlineVector() = default;
+
+    constexpr InlineVector(std::initializer_list<T> entries) {
+        for (const auto &e : entries) {
+            push_back(e);
+        }
+    }
+
+    // Only live entries are copied and moved
+    constexpr InlineVector(const InlineVector &other) : heap_(other.heap_), dropped_(other.dropped_) {
+        if (!other.spilled()) {
+            std::copy(other.storage_.begin(), other.storage_.begin() + other.size_, storage_.begin());
+            size_ = other.size_;
+        }
+    }
+
+    constexpr InlineVector(InlineVector &&other) noexcept(std::is_nothrow_move_assignable_v<T>)
+        : heap_(std::exchange(other.heap_, {}))
+        , dropped_(std::exchange(other.dropped_, 0))
+    {
+        std::move(other.storage_.begin(), other.storage_.begin() + other.size_, storage_.begin());
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    constexpr InlineVector &operator=(const InlineVector &other) {
+        if (this != &other) {
+            *this = InlineVector(other);
+        }
+        return *this;
+    }
+
+    constexpr InlineVector &operator=(InlineVector &&other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        if (this != &other) {
+            clear();
+            heap_ = std::exchange(other.heap_, {});
+            dropped_ = std::exchange(other.dropped_, 0);
+            std::move(other.storage_.begin(), other.storage_.begin() + other.size_, storage_.begin());
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    constexpr ~InlineVector() = default;
+
+    constexpr void push_back(const T &value) { emplace_back(value); }
+
+    constexpr void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    /*!
+     * Add an entry. If the vector is full, the overflow policy decides what happens.
+     *
+     * @return a pointer to the new entry, or nullptr if it's dropped.
+     */
+    template <class... Args>
+    constexpr T *emplace_back(Args &&...args) {
+        if constexpr (spills) {
+            if (spilled()) {
+                return &heap_.emplace_back(std::forward<Args>(args)...);
+            }
+        }
+
+        if (size_ == N) {
+            if constexpr (spills) {
+                spill(N + 1);
+                return &heap_.emplace_back(std::forward<Args>(args)...);
+            } else if constexpr (std::is_same_v<Overflow, overflow::Drop>) {
+                ++dropped_;
+                return nullptr;
+            } else {
+                std::terminate();
+            }
+        }
+
+        storage_[size_] = T(std::forward<Args>(args)...);
+        return &storage_[size_++];
+    }
+
+    /*!
+     * Append entries of \p other, it's moved from if it's an rvalue.
+     */
+    template <class V>
+    requires std::same_as<std::remove_cvref_t<V>, InlineVector>
+    constexpr InlineVector &append(V &&other) {
+        if constexpr (spills && std::is_rvalue_reference_v<V &&>) {
+            if (empty() && other.spilled()) {
+                heap_ = std::exchange(other.heap_, {});
+                dropped_ += std::exchange(other.dropped_, 0);
+                return *this;
+            }
+        }
+
+        reserve(size() + other.size());
+        for (auto &e : other) {
+            if constexpr (std::is_rvalue_reference_v<V &&>) {
+                emplace_back(std::move(e));
+            } else {
+                emplace_back(e);
+            }
+        }
+        dropped_ += other.dropped_;
+
+        return *this;
+    }
+
+    /*!
+     * Only spilling vectors can grow beyond \p N, for other policies this is a no-op.
+     */
+    constexpr void reserve(size_type size) {
+        if constexpr (spills) {
+            if (spilled()) {
+                heap_.reserve(size);
+            } else if (size > N) {
+                spill(size);
+            }
+        }
+    }
+
+    constexpr void clear() noexcept(std::is_nothrow_default_constructible_v<T>) {
+        std::fill(storage_.begin(), storage_.begin() + size_, T());
+        size_ = 0;
+        if constexpr (spills) {
+            heap_ = std::vector<T>();
+        }
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        if constexpr (spills) {
+            if (spilled()) {
+                return heap_.size();
+            }
+        }
+        return size_;
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept {
+        if constexpr (spills) {
+            return heap_.max_size();
+        } else {
+            return N;
+        }
+    }
+
+    [[nodiscard]] constexpr size_type capacity() const noexcept {
+        if constexpr (spills) {
+            return std::max(N, heap_.capacity());
+        } else {
+            return N;
+        }
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    /*!
+     * Check if entries are on the heap. Always false unless the policy is \p overflow::Spill.
+     */
+    [[nodiscard]] constexpr bool spilled() const noexcept {
+        if constexpr (spills) {
+            return heap_.capacity() > 0;
+        } else {
+            return false;
+        }
+    }
+
+    /*!
+     * The number of entries discarded by \p overflow::Drop.
+     */
+    [[nodiscard]] constexpr size_type dropped() const noexcept { return dropped_; }
+
+    [[nodiscard]] constexpr T *data() noexcept {
+        if constexpr (spills) {
+            if (spilled()) {
+                return heap_.data();
+            }
+        }
+        return storage_.data();
+    }
+
+    [[nodiscard]] constexpr const T *data() const noexcept { return const_cast<InlineVector *>(this)->data(); }
+
+    [[nodiscard]] constexpr reference operator[](size_type i) noexcept { return data()[i]; }
+    [[nodiscard]] constexpr const_reference operator[](size_type i) const noexcept { return data()[i]; }
+
+    [[nodiscard]] constexpr reference back() noexcept { return data()[size() - 1]; }
+    [[nodiscard]] constexpr const_reference back() const noexcept { return data()[size() - 1]; }
+
+    [[nodiscard]] constexpr iterator begin() noexcept { return data(); }
+    [[nodiscard]] constexpr iterator end() noexcept { return data() + size(); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return data(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return data() + size(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+    constexpr void swap(InlineVector &other) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        std::swap(*this, other);
+    }
+
+    friend constexpr bool operator==(const InlineVector &lhs, const InlineVector &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    constexpr void spill(size_type capacity) requires spills {
+        std::vector<T> heap;
+        heap.reserve(std::max(capacity, 2 * N));
+        std::move(storage_.begin(), storage_.begin() + size_, std::back_inserter(heap));
+        std::fill(storage_.begin(), storage_.begin() + size_, T());
+        size_ = 0;
+        heap_ = std::move(heap);
+    }
+
+    std::array<T, N> storage_{};
+    FL_NO_UNIQUE_ADDRESS std::conditional_t<spills, std::vector<T>, NoHeap> heap_;
+    size_type size_ = 0;
+    size_type dropped_ = 0;
+};
+
+/*!
+ * Vector with \p N entries in place that moves to the heap when it gets bigger.
+ */
+template <class T, std::size_t N>
+using SmallVector = InlineVector<T, N, overflow::Spill>;
+
+/*!
+ * Vector that never allocates and holds at most \p N entries.
+ */
+template <class T, std::size_t N, class Overflow = overflow::Terminate>
+using StaticVector = InlineVector<T, N, Overflow>;
+
+} // namespace fl
@@ -0,0 +1,181 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <cstdint>
+#include <compare>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fl {
+
+/*!
+ * Table of unique strings, each string is identified by a small integer.
+ *
+ * Strings are never removed, so views returned by \p str() stay valid as long as the table exists. The table is
+ * thread-safe.
+ */
+class StringTable {
+public:
+    using Id = std::uint32_t;
+
+    StringTable() = default;
+
+    StringTable(const StringTable &) = delete;
+    StringTable &operator=(const StringTable &) = delete;
+
+    /*!
+     * The table used by \p fl::intern.
+     */
+    [[nodiscard]]
+    static StringTable &global() {
+        static StringTable table;
+        return table;
+    }
+
+    /*!
+     * Get the identifier of \p s, it's added to the table if necessary.
+     */
+    [[nodiscard]]
+    Id intern(std::string_view s) {
+        {
+            std::shared_lock lock(mutex_);
+            if (auto it = ids_.find(s); it != ids_.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(mutex_);
+        if (auto it = ids_.find(s); it != ids_.end()) {
+            return it->second;
+        }
+
+        if (strings_.size() >= std::numeric_limits<Id>::max()) {
+            throw std::length_error("String table is full");
+        }
+
+        const auto id = static_cast<Id>(strings_.size());
+        ids_.emplace(strings_.emplace_back(s), id);
+
+        return id;
+    }
+
+    /*!
+     * Get the string identified by \p id, which must be returned by \p intern of this table.
+     */
+    [[nodiscard]]
+    std::string_view str(Id id) const {
+        std::shared_lock lock(mutex_);
+        return strings_[id];
+    }
+
+    [[nodiscard]]
+    std::size_t size() const {
+        std::shared_lock lock(mutex_);
+        return strings_.size();
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    // References to elements of std::deque are stable, so the map refers to them
+    std::deque<std::string> strings_;
+    std::unordered_map<std::string_view, Id> ids_;
+};
+
+/*!
+ * Log entry that refers to a string of the global string table, e.g. a message template, and carries an optional
+ * payload, e.g. arguments of the message.
+ *
+ * Without a payload an entry takes 4 bytes, so combining logs of such entries copies a few bytes per entry regardless
+ * of the length of the messages.
+ *
+ * @tparam Payload the type of the payload.
+ */
+template <class Payload = void>
+struct Interned {
+    StringTable::Id id;
+    Payload payload;
+
+    [[nodiscard]] std::string_view str() const { return StringTable::global().str(id); }
+
+    auto operator<=>(const Interned &) const = default;
+    bool operator==(const Interned &) const = default;
+};
+
+template <>
+struct Interned<void> {
+    StringTable::Id id;
+
+    [[nodiscard]] std::string_view str() const { return StringTable::global().str(id); }
+
+    auto operator<=>(const Interned &) const = default;
+    bool operator==(const Interned &) const = default;
+};
+
+template <class Payload = void>
+using InternedLog = std::vector<Interned<Payload>>;
+
+namespace details {
+
+// Threads look up strings they have seen before without locking the global table
+[[nodiscard]]
+inline StringTable::Id internCached(std::string_view s) {
+    thread_local std::unordered_map<std::string_view, StringTable::Id> cache;
+
+    if (auto it = cache.find(s); it != cache.end()) {
+        return it->second;
+    }
+
+    const auto id = StringTable::global().intern(s);
+    cache.emplace(StringTable::global().str(id), id);
+
+    return id;
+}
+
+} // namespace details
+
+/*!
+ * Create an entry for \p s from the global string table.
+ */
+[[nodiscard]]
+inline Interned<> intern(std::string_view s) {
+    return {details::internCached(s)};
+}
+
+/*!
+ * Create an entry for \p s from the global string table with \p payload.
+ */
+template <class Payload>
+[[nodiscard]]
+Interned<std::remove_cvref_t<Payload>> intern(std::string_view s, Payload &&payload) {
+    return {details::internCached(s), std::forward<Payload>(payload)};
+}
+
+inline std::ostream &operator<<(std::ostream &os, const Interned<> &entry) {
+    return os << entry.str();
+}
+
+template <class Payload>
+std::ostream &operator<<(std::ostream &os, const Interned<Payload> &entry) {
+    return os << entry.str() << ' ' << entry.payload;
+}
+
+} // namespace fl
@@ -0,0 +1,123 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <compare>
+#include <concepts>
+#include <string_view>
+#include <ostream>
+
+namespace fl {
+
+/*!
+ * Severity of log entries.
+ */
+enum class Level : std::uint8_t { Trace, Debug, Info, Warn, Error, Critical, Off };
+
+[[nodiscard]]
+constexpr std::string_view to_string(Level level) noexcept {
+    switch (level) {
+        case Level::Trace: return "trace";
+        case Level::Debug: return "debug";
+        case Level::Info: return "info";
+        case Level::Warn: return "warn";
+        case Level::Error: return "error";
+        case Level::Critical: return "critical";
+        case Level::Off: return "off";
+    }
+
+    return {};
+}
+
+inline std::ostream &operator<<(std::ostream &os, Level level) {
+    return os << to_string(level);
+}
+
+/*!
+ * Log entry with severity level.
+ *
+ * @tparam T the type of entry.
+ */
+template <class T>
+struct Leveled {
+    Level level;
+    T entry;
+
+    auto operator<=>(const Leveled &) const = default;
+    bool operator==(const Leveled &) const = default;
+};
+
+template <class T>
+Leveled(Level, T) -> Leveled<T>;
+
+/*!
+ * Filters decide whether an entry of the given level is added to the log. A filter is invoked with the level before
+ * the entry is created. Filters with \p compiled_in<L> equal to false remove entries of the level \p L at compile time.
+ */
+namespace filters {
+
+/*!
+ * Pass entries of the level \p min and above, the level can be changed at runtime.
+ */
+struct Threshold {
+    [[nodiscard]]
+    constexpr bool operator()(Level level) const noexcept { return level >= min && level != Level::Off; }
+
+    Level min = Level::Info;
+};
+
+/*!
+ * Pass entries of the level \p Min and above. Other entries are removed at compile time.
+ */
+template <Level Min>
+struct StaticThreshold {
+    template <Level L>
+    static constexpr bool compiled_in = L >= Min && L != Level::Off;
+
+    [[nodiscard]]
+    constexpr bool operator()(Level level) const noexcept { return level >= Min && level != Level::Off; }
+};
+
+/*!
+ * Pass the first entry and then each \p every -th entry regardless of its level.
+ */
+class Sampling {
+public:
+    constexpr explicit Sampling(std::size_t every) noexcept : every_(every == 0 ? 1 : every) {}
+
+    [[nodiscard]]
+    constexpr bool operator()(Level) noexcept {
+        const bool pass = counter_ == 0;
+        counter_ = (counter_ + 1) % every_;
+        return pass;
+    }
+
+private:
+    std::size_t every_;
+    std::size_t counter_ = 0;
+};
+
+} // namespace filters
+
+namespace details {
+
+template <class Filter, Level L>
+constexpr bool compiled_in = true;
+
+template <class Filter, Level L>
+requires requires { { Filter::template compiled_in<L> } -> std::convertible_to<bool>; }
+constexpr bool compiled_in<Filter, L> = Filter::template compiled_in<L>;
+
+} // namespace details
+
+} // namespace fl
@@ -0,0 +1,177 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+#include <initializer_list>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+
+namespace fl {
+
+/*!
+ * Map that combines values of equal keys instead of dropping them.
+ *
+ * Values are combined with \p Semigroup<T>, e.g. numbers are added and strings are concatenated. It can be used as
+ * a log for keyed aggregation, for example:
+ * \code{.cpp}
+ *    using Counters = fl::MergeMap<std::string, std::uint64_t>;
+ *    auto w = fl::Writer<Counters, int>{{}, 42}.tell(std::pair{"requests", 1}).tell(std::pair{"requests", 2});
+ *    // w.log().at("requests") == 3
+ * \endcode
+ *
+ * @tparam Key the type of keys.
+ * @tparam T the type of values, \p Semigroup<T> must exist.
+ * @tparam Map the underlying map, e.g. std::unordered_map<Key, T>.
+ */
+template <class Key, class T, class Map = std::map<Key, T>>
+class MergeMap {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = typename Map::value_type;
+    using size_type = typename Map::size_type;
+    using const_iterator = typename Map::const_iterator;
+    using allocator_type = typename Map::allocator_type;
+    using MapType = Map;
+
+    MergeMap() = default;
+
+    explicit MergeMap(const allocator_type &alloc) : map_(alloc) {}
+
+    MergeMap(const MergeMap &other, const allocator_type &alloc) : map_(other.map_, alloc) {}
+
+    MergeMap(std::initializer_list<value_type> entries) {
+        for (const auto &e : entries) {
+            add(e.first, e.second);
+        }
+    }
+
+    /*!
+     * Add \p value for \p key, it's combined with the existing value if there is one.
+     */
+    template <class K, class V>
+    requires std::constructible_from<Key, K &&> &&
+        (std::constructible_from<T, V &&> || concepts::details::CombinableWithValue<Semigroup<T>, T, V>)
+    MergeMap &add(K &&key, V &&value) {
+        if constexpr (concepts::Same<V, T> || !concepts::details::CombinableWithValue<Semigroup<T>, T, V>) {
+            // Arguments are not moved from if the key exists
+            if (auto [it, inserted] = map_.try_emplace(Key(std::forward<K>(key)), std::forward<V>(value)); !inserted) {
+                combineValue(it->second, std::forward<V>(value));
+            }
+        } else {
+            // Parts of values, e.g. elements of containers, are combined with an empty value
+            auto it = map_.try_emplace(Key(std::forward<K>(key))).first;
+            combine_into(Semigroup<T>(), it->second, std::forward<V>(value));
+        }
+
+        return *this;
+    }
+
+    /*!
+     * Add a key-value pair, e.g. std::pair{"requests", 1}.
+     */
+    template <class P>
+    requires requires(P &&p) {
+        std::forward<P>(p).first;
+        std::forward<P>(p).second;
+    }
+    MergeMap &add(P &&entry) {
+        return add(std::forward<P>(entry).first, std::forward<P>(entry).second);
+    }
+
+    /*!
+     * Add all entries of \p other. Nodes of rvalue maps with new keys are moved without allocations.
+     */
+    MergeMap &merge(MergeMap &&other) {
+        if (&other == this) {
+            return merge(MergeMap(std::as_const(other)));
+        }
+
+        if (!sameAllocator(other)) {
+            return merge(std::as_const(other));
+        }
+
+        while (!other.map_.empty()) {
+            auto node = other.map_.extract(other.map_.begin());
+            if (auto it = map_.find(node.key()); it != map_.end()) {
+                combineValue(it->second, std::move(node.mapped()));
+            } else {
+                map_.insert(std::move(node));
+            }
+        }
+
+        return *this;
+    }
+
+    MergeMap &merge(const MergeMap &other) {
+        if (&other == this) {
+            return merge(MergeMap(other));
+        }
+
+        for (const auto &[key, value] : other.map_) {
+            add(key, value);
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] const_iterator find(const Key &key) const { return map_.find(key); }
+
+    [[nodiscard]] bool contains(const Key &key) const { return map_.contains(key); }
+
+    [[nodiscard]] const T &at(const Key &key) const { return map_.at(key); }
+
+    [[nodiscard]] size_type size() const noexcept { return map_.size(); }
+
+    [[nodiscard]] bool empty() const noexcept { return map_.empty(); }
+
+    [[nodiscard]] allocator_type get_allocator() const { return map_.get_allocator(); }
+
+    [[nodiscard]] const Map &map() const & noexcept { return map_; }
+
+    [[nodiscard]] Map map() && noexcept { return std::move(map_); }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return map_.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return map_.end(); }
+
+    void clear() noexcept { map_.clear(); }
+
+    friend bool operator==(const MergeMap &lhs, const MergeMap &rhs) { return lhs.map_ == rhs.map_; }
+
+private:
+    // Values are converted if the semigroup can't combine them directly, e.g. int and std::uint64_t
+    template <class V>
+    static void combineValue(T &acc, V &&value) {
+        if constexpr (concepts::details::CombinableWithValue<Semigroup<T>, T, V>) {
+            combine_into(Semigroup<T>(), acc, std::forward<V>(value));
+        } else {
+            combine_into(Semigroup<T>(), acc, T(std::forward<V>(value)));
+        }
+    }
+
+    bool sameAllocator(const MergeMap &other) const {
+        if constexpr (std::allocator_traits<allocator_type>::is_always_equal::value) {
+            return true;
+        } else {
+            return map_.get_allocator() == other.map_.get_allocator();
+        }
+    }
+
+    Map map_;
+};
+
+} // namespace fl
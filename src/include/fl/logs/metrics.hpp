@@ -0,0 +1,115 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fl {
+
+/*!
+ * Log that counts events instead of describing them, e.g. the number of retries.
+ *
+ * @tparam T the type of the counter.
+ */
+template <class T = std::uint64_t>
+requires std::is_arithmetic_v<T>
+class Counter {
+public:
+    using value_type = T;
+
+    constexpr Counter() = default;
+
+    constexpr explicit Counter(T value) noexcept : value_(value) {}
+
+    constexpr Counter &add(T n = T(1)) noexcept {
+        value_ += n;
+        return *this;
+    }
+
+    constexpr Counter &merge(const Counter &other) noexcept { return add(other.value_); }
+
+    [[nodiscard]] constexpr T value() const noexcept { return value_; }
+
+    constexpr bool operator==(const Counter &) const = default;
+
+private:
+    T value_{};
+};
+
+/*!
+ * Log that keeps the number, the sum, the minimum and the maximum of samples, e.g. durations of requests.
+ *
+ * The default constructed object has no samples, it's the identity of merging.
+ *
+ * @tparam T the type of samples.
+ */
+template <class T = double>
+requires std::is_arithmetic_v<T>
+class Stats {
+public:
+    using value_type = T;
+    using size_type = std::uint64_t;
+
+    constexpr Stats() = default;
+
+    constexpr Stats &add(T sample) noexcept {
+        ++count_;
+        sum_ += sample;
+        min_ = std::min(min_, sample);
+        max_ = std::max(max_, sample);
+        return *this;
+    }
+
+    constexpr Stats &merge(const Stats &other) noexcept {
+        count_ += other.count_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr size_type count() const noexcept { return count_; }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return count_ == 0; }
+
+    [[nodiscard]] constexpr T sum() const noexcept { return sum_; }
+
+    /*!
+     * The minimal sample, the maximal value of \p T if there are no samples.
+     */
+    [[nodiscard]] constexpr T min() const noexcept { return min_; }
+
+    /*!
+     * The maximal sample, the lowest value of \p T if there are no samples.
+     */
+    [[nodiscard]] constexpr T max() const noexcept { return max_; }
+
+    /*!
+     * The arithmetic mean, 0 if there are no samples.
+     */
+    [[nodiscard]]
+    constexpr double mean() const noexcept {
+        return empty() ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+    }
+
+    constexpr bool operator==(const Stats &) const = default;
+
+private:
+    size_type count_ = 0;
+    T sum_{};
+    T min_ = std::numeric_limits<T>::max();
+    T max_ = std::numeric_limits<T>::lowest();
+};
+
+} // namespace fl
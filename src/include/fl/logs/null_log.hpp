@@ -0,0 +1,58 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+namespace fl {
+
+/*!
+ * Log that discards all entries.
+ *
+ * Use it instead of a real log to switch logging off without changing the code: the log is constructible from any
+ * arguments, combining is a no-op, and \p Writer<NullLog, Value> has the same size as \p Value. Entries passed to
+ * \p Writer::tell_with are not even created.
+ */
+struct NullLog {
+    constexpr NullLog() noexcept = default;
+
+    template <class... Args>
+    constexpr NullLog(Args &&...) noexcept {} // NOLINT
+
+    constexpr auto operator<=>(const NullLog &) const noexcept = default;
+};
+
+/*!
+ * Check if a log discards all entries. Specialize it for custom log types that do so.
+ */
+template <class Log>
+struct discards_entries : std::false_type {};
+
+template <>
+struct discards_entries<NullLog> : std::true_type {};
+
+template <class Log>
+inline constexpr bool discards_entries_v = discards_entries<std::remove_cvref_t<Log>>::value;
+
+namespace concepts {
+
+/*!
+ * An entry that a log could hold. Functions are rejected: they create entries and are passed to \p tell_with.
+ */
+template <class Entry>
+concept DiscardedEntry =
+    std::is_object_v<std::remove_cvref_t<Entry>> && !std::invocable<std::remove_cvref_t<Entry> &>;
+
+} // namespace concepts
+
+} // namespace fl
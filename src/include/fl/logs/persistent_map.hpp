@@ -0,0 +1,424 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fl/utils/attributes.hpp>
+#include <fl/utils/hash.hpp>
+
+namespace fl {
+
+/*!
+ * Persistent hash map, e.g. a log of keyed state snapshots.
+ *
+ * The map is a hash array mapped trie of reference-counted nodes. Copying is O(1), and copies share all nodes.
+ * Nodes are mutated in place only when this map is their sole owner; otherwise the path to the changed entry is
+ * copied, so copies never observe each other's changes. Like std::shared_ptr, copies can be read, changed and
+ * destroyed in different threads, a single map can't be changed concurrently.
+ *
+ * Merging reuses subtrees: the ones shared by both maps are skipped, and the ones present in a single map are
+ * taken as is. Merging a map with its modified copy costs O(changes) rather than O(size). Values of the merged map
+ * win on equal keys.
+ *
+ * @tparam Key the type of keys.
+ * @tparam T the type of values.
+ * @tparam Hash the hash of keys.
+ * @tparam Equal the comparison of keys, it's transparent by default.
+ */
+template <class Key, class T, class Hash = std::hash<Key>, class Equal = std::equal_to<>>
+class PersistentMap {
+    struct Node;
+    class NodePtr;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+
+    PersistentMap() = default;
+
+    PersistentMap(std::initializer_list<value_type> entries) {
+        for (const auto &[key, value] : entries) {
+            set(key, value);
+        }
+    }
+
+    /*!
+     * Set the value of \p key, the previous value is replaced.
+     */
+    template <class K, class V>
+    requires std::constructible_from<Key, K &&> && std::constructible_from<T, V &&>
+    PersistentMap &set(K &&key, V &&value) {
+        insert(root_, hashOf(key), std::forward<K>(key), std::forward<V>(value), 0, true);
+        return *this;
+    }
+
+    /*!
+     * Remove \p key.
+     * @return the number of removed entries, i.e. 0 or 1.
+     */
+    template <class K>
+    size_type erase(const K &key) {
+        const auto h = hashOf(key);
+        if (!findIn(root_.get(), h, key)) {
+            return 0;
+        }
+
+        remove(root_, h, key, 0);
+        return 1;
+    }
+
+    /*!
+     * Merge \p other into this map, values of \p other win on equal keys.
+     */
+    PersistentMap &merge(const PersistentMap &other) {
+        mergeInto(root_, other.root_, 0);
+        return *this;
+    }
+
+    /*!
+     * Get the value of \p key.
+     * @return a pointer to the value, or nullptr if there is no such key.
+     */
+    template <class K>
+    [[nodiscard]]
+    const T *find(const K &key) const {
+        return findIn(root_.get(), hashOf(key), key);
+    }
+
+    template <class K>
+    [[nodiscard]]
+    bool contains(const K &key) const {
+        return find(key) != nullptr;
+    }
+
+    template <class K>
+    [[nodiscard]]
+    const T &at(const K &key) const {
+        if (const auto *value = find(key)) {
+            return *value;
+        }
+        throw std::out_of_range("PersistentMap::at: no such key");
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return root_ ? root_->size : 0; }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /*!
+     * Invoke \p f for each entry in an unspecified order.
+     *
+     * @param f function that accepts const Key& and const T&.
+     */
+    template <class F>
+    void for_each(F &&f) const {
+        if (!root_) {
+            return;
+        }
+
+        std::vector<const Node *> stack{root_.get()};
+        while (!stack.empty()) {
+            const auto *node = stack.back();
+            stack.pop_back();
+
+            for (const auto &[key, value] : node->entries) {
+                std::invoke(f, key, value);
+            }
+            for (const auto &child : node->children) {
+                stack.push_back(child.get());
+            }
+        }
+    }
+
+    /*!
+     * Check if both maps share the same root, i.e. one of them is an unmodified copy of the other.
+     */
+    [[nodiscard]]
+    bool shares_root_with(const PersistentMap &other) const noexcept {
+        return root_ == other.root_;
+    }
+
+    void clear() noexcept { root_.reset(); }
+
+    friend bool operator==(const PersistentMap &lhs, const PersistentMap &rhs) {
+        if (lhs.root_ == rhs.root_) {
+            return true;
+        }
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        bool equal = true;
+        lhs.for_each([&](const Key &key, const T &value) {
+            const auto *other = equal ? rhs.find(key) : nullptr;
+            equal = other && *other == value;
+        });
+
+        return equal;
+    }
+
+private:
+    static constexpr unsigned bits_per_level = 5;
+    static constexpr std::uint64_t level_mask = (1u << bits_per_level) - 1;
+
+    // A copied node starts with its own count
+    struct RefCount {
+        RefCount() = default;
+        RefCount(const RefCount &) noexcept {}
+        RefCount &operator=(const RefCount &) = delete;
+
+        std::atomic<size_type> count{1};
+    };
+
+    // Branches have children and no entries, leaves have entries with the same hash and no children
+    struct Node {
+        size_type size = 0;
+        std::uint64_t hash = 0;
+        std::uint32_t bitmap = 0;
+        std::vector<NodePtr> children;
+        std::vector<value_type> entries;
+        RefCount refs;
+
+        [[nodiscard]] bool leaf() const noexcept { return !entries.empty(); }
+
+        // The position of the child for the bit, children are ordered by their bits
+        [[nodiscard]]
+        size_type position(std::uint32_t bit) const noexcept {
+            return static_cast<size_type>(std::popcount(bitmap & (bit - 1)));
+        }
+    };
+
+    // Owner of a node. Unlike std::shared_ptr::use_count, unique() is an acquire load that synchronizes with the
+    // releasing decrements of other owners, so a node is changed in place only after their reads of it are finished.
+    class NodePtr {
+    public:
+        NodePtr() = default;
+
+        explicit NodePtr(Node node) : node_(new Node(std::move(node))) {}
+
+        NodePtr(const NodePtr &other) noexcept : node_(other.node_) {
+            if (node_) {
+                node_->refs.count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        NodePtr(NodePtr &&other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+
+        NodePtr &operator=(NodePtr other) noexcept {
+            std::swap(node_, other.node_);
+            return *this;
+        }
+
+        ~NodePtr() { reset(); }
+
+        void reset() noexcept {
+            if (auto *node = std::exchange(node_, nullptr);
+                node && node->refs.count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete node;
+            }
+        }
+
+        [[nodiscard]] bool unique() const noexcept { return node_->refs.count.load(std::memory_order_acquire) == 1; }
+
+        [[nodiscard]] Node *get() const noexcept { return node_; }
+        Node *operator->() const noexcept { return node_; }
+        Node &operator*() const noexcept { return *node_; }
+        explicit operator bool() const noexcept { return node_ != nullptr; }
+
+        friend bool operator==(const NodePtr &, const NodePtr &) = default;
+
+    private:
+        Node *node_ = nullptr;
+    };
+
+    [[nodiscard]]
+    static std::uint32_t bitOf(std::uint64_t hash, unsigned shift) noexcept {
+        return std::uint32_t(1) << ((hash >> shift) & level_mask);
+    }
+
+    template <class K>
+    [[nodiscard]]
+    std::uint64_t hashOf(const K &key) const {
+        return details::mixHash(static_cast<std::uint64_t>(hash_(key)));
+    }
+
+    // Shared nodes are copied before they are changed
+    static Node &writable(NodePtr &node) {
+        if (!node.unique()) {
+            node = NodePtr(*node);
+        }
+        return *node;
+    }
+
+    template <class K>
+    [[nodiscard]]
+    const T *findIn(const Node *node, std::uint64_t hash, const K &key) const {
+        for (unsigned shift = 0; node && !node->leaf(); shift += bits_per_level) {
+            const auto bit = bitOf(hash, shift);
+            node = (node->bitmap & bit) ? node->children[node->position(bit)].get() : nullptr;
+        }
+
+        if (node && node->hash == hash) {
+            for (const auto &[k, value] : node->entries) {
+                if (equal_(k, key)) {
+                    return &value;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Returns true if the key is added, existing values are replaced only if requested
+    template <class K, class V>
+    bool insert(NodePtr &node, std::uint64_t hash, K &&key, V &&value, unsigned shift, bool replace) {
+        if (!node) {
+            node = NodePtr(Node{1, hash, 0, {}, {}, {}});
+            node->entries.emplace_back(std::forward<K>(key), std::forward<V>(value));
+            return true;
+        }
+
+        if (node->leaf()) {
+            if (node->hash == hash) {
+                for (size_type i = 0; i < node->entries.size(); ++i) {
+                    if (equal_(node->entries[i].first, key)) {
+                        if (replace) {
+                            writable(node).entries[i].second = std::forward<V>(value);
+                        }
+                        return false;
+                    }
+                }
+
+                // Keys with equal hashes share a leaf
+                auto &leaf = writable(node);
+                leaf.entries.emplace_back(std::forward<K>(key), std::forward<V>(value));
+                ++leaf.size;
+                return true;
+            }
+
+            // The leaf is moved one level down, so the new key gets its own place
+            NodePtr branch(Node{node->size, 0, bitOf(node->hash, shift), {}, {}, {}});
+            branch->children.push_back(std::move(node));
+            node = std::move(branch);
+        }
+
+        auto &branch = writable(node);
+        const auto bit = bitOf(hash, shift);
+        const auto pos = branch.position(bit);
+        if (!(branch.bitmap & bit)) {
+            NodePtr leaf;
+            insert(leaf, hash, std::forward<K>(key), std::forward<V>(value), shift + bits_per_level, replace);
+            branch.children.insert(branch.children.begin() + std::ptrdiff_t(pos), std::move(leaf));
+            branch.bitmap |= bit;
+            ++branch.size;
+            return true;
+        }
+
+        const bool added =
+            insert(branch.children[pos], hash, std::forward<K>(key), std::forward<V>(value), shift + bits_per_level,
+                   replace);
+        branch.size += added;
+        return added;
+    }
+
+    // The key must be present
+    template <class K>
+    void remove(NodePtr &node, std::uint64_t hash, const K &key, unsigned shift) {
+        if (node->leaf()) {
+            if (node->entries.size() == 1) {
+                node.reset();
+                return;
+            }
+
+            auto &leaf = writable(node);
+            std::erase_if(leaf.entries, [&](const auto &e) { return equal_(e.first, key); });
+            --leaf.size;
+            return;
+        }
+
+        auto &branch = writable(node);
+        const auto bit = bitOf(hash, shift);
+        const auto pos = branch.position(bit);
+        remove(branch.children[pos], hash, key, shift + bits_per_level);
+        --branch.size;
+
+        if (!branch.children[pos]) {
+            branch.children.erase(branch.children.begin() + std::ptrdiff_t(pos));
+            branch.bitmap &= ~bit;
+        }
+
+        // Leaves don't depend on their levels, so a branch with a single leaf is replaced by the leaf
+        if (branch.children.empty()) {
+            node.reset();
+        } else if (branch.children.size() == 1 && branch.children.front()->leaf()) {
+            node = NodePtr(branch.children.front());
+        }
+    }
+
+    void mergeInto(NodePtr &acc, const NodePtr &v, unsigned shift) {
+        if (!v || acc == v) {
+            return;
+        }
+        if (!acc) {
+            acc = v;
+            return;
+        }
+
+        if (v->leaf()) {
+            for (const auto &[key, value] : v->entries) {
+                insert(acc, v->hash, key, value, shift, true);
+            }
+            return;
+        }
+
+        if (acc->leaf()) {
+            NodePtr result = v;
+            for (const auto &[key, value] : acc->entries) {
+                insert(result, acc->hash, key, value, shift, false);
+            }
+            acc = std::move(result);
+            return;
+        }
+
+        auto &branch = writable(acc);
+        for (auto bits = v->bitmap; bits != 0; bits &= bits - 1) {
+            const auto bit = bits & (~bits + 1);
+            const auto &child = v->children[v->position(bit)];
+            const auto pos = branch.position(bit);
+
+            if (!(branch.bitmap & bit)) {
+                branch.children.insert(branch.children.begin() + std::ptrdiff_t(pos), child);
+                branch.bitmap |= bit;
+                branch.size += child->size;
+            } else {
+                const auto before = branch.children[pos]->size;
+                mergeInto(branch.children[pos], child, shift + bits_per_level);
+                branch.size = branch.size - before + branch.children[pos]->size;
+            }
+        }
+    }
+
+    NodePtr root_;
+    FL_NO_UNIQUE_ADDRESS Hash hash_;
+    FL_NO_UNIQUE_ADDRESS Equal equal_;
+};
+
+} // namespace fl
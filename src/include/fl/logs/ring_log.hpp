@@ -0,0 +1,172 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace fl {
+
+/*!
+ * Log that keeps the last \p N entries.
+ *
+ * Entries are stored in a circular buffer that is allocated on demand up to \p N entries. When the log is full, new
+ * entries overwrite the oldest ones, so appending a full log replaces all entries.
+ *
+ * @tparam T the type of entries.
+ * @tparam N the maximal number of entries.
+ */
+template <class T, std::size_t N>
+class RingLog {
+    static_assert(N > 0);
+
+public:
+    class const_iterator;
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const T &;
+    using iterator = const_iterator;
+
+    static constexpr size_type max_entries = N;
+
+    RingLog() = default;
+
+    RingLog(std::initializer_list<T> entries) {
+        for (const auto &e : entries) {
+            push_back(e);
+        }
+    }
+
+    void push_back(const T &value) { emplace_back(value); }
+
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    template <class... Args>
+    void emplace_back(Args &&...args) {
+        if (buffer_.size() < N) {
+            buffer_.emplace_back(std::forward<Args>(args)...);
+        } else {
+            buffer_[head_] = T(std::forward<Args>(args)...);
+            head_ = (head_ + 1) % N;
+            ++dropped_;
+        }
+    }
+
+    /*!
+     * Append entries of \p other, the oldest entries of this log are overwritten if there is not enough space.
+     */
+    template <class L>
+    requires std::same_as<std::remove_cvref_t<L>, RingLog>
+    RingLog &append(L &&other) {
+        if (this == &other) {
+            return append(RingLog(other));
+        }
+
+        // Nothing is left from this log, so the buffer of other is taken as is
+        if (empty() || other.full()) {
+            dropped_ += size() + other.dropped_;
+            head_ = other.head_;
+            buffer_ = std::forward<L>(other).buffer_;
+            if constexpr (std::is_same_v<L &&, RingLog &&>) {
+                other.clear();
+            }
+            return *this;
+        }
+
+        dropped_ += other.dropped_;
+        for (size_type i = 0; i < other.size(); ++i) {
+            if constexpr (std::is_same_v<L &&, RingLog &&>) {
+                emplace_back(std::move(other.slot(i)));
+            } else {
+                emplace_back(other[i]);
+            }
+        }
+
+        return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return buffer_.size(); }
+
+    [[nodiscard]] size_type max_size() const noexcept { return N; }
+
+    [[nodiscard]] bool empty() const noexcept { return buffer_.empty(); }
+
+    [[nodiscard]] bool full() const noexcept { return buffer_.size() == N; }
+
+    /*!
+     * The number of entries overwritten or skipped because of the bound.
+     */
+    [[nodiscard]] size_type dropped() const noexcept { return dropped_; }
+
+    /*!
+     * Entries from the oldest to the newest one.
+     */
+    [[nodiscard]] const T &operator[](size_type i) const noexcept { return buffer_[(head_ + i) % buffer_.size()]; }
+
+    [[nodiscard]] const T &front() const noexcept { return (*this)[0]; }
+    [[nodiscard]] const T &back() const noexcept { return (*this)[size() - 1]; }
+
+    void clear() noexcept {
+        buffer_.clear();
+        head_ = 0;
+        dropped_ = 0;
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return {this, 0}; }
+    [[nodiscard]] const_iterator end() const noexcept { return {this, size()}; }
+
+    friend bool operator==(const RingLog &lhs, const RingLog &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+
+        reference operator*() const noexcept { return (*log_)[index_]; }
+        pointer operator->() const noexcept { return &(*log_)[index_]; }
+
+        const_iterator &operator++() noexcept { ++index_; return *this; }
+        const_iterator operator++(int) noexcept { auto tmp = *this; ++index_; return tmp; }
+
+        bool operator==(const const_iterator &other) const noexcept { return index_ == other.index_; }
+
+    private:
+        friend class RingLog;
+
+        const_iterator(const RingLog *log, size_type index) : log_(log), index_(index) {}
+
+        const RingLog *log_ = nullptr;
+        size_type index_ = 0;
+    };
+
+private:
+    T &slot(size_type i) noexcept { return buffer_[(head_ + i) % buffer_.size()]; }
+
+    std::vector<T> buffer_;
+    size_type head_ = 0;
+    size_type dropped_ = 0;
+};
+
+} // namespace fl
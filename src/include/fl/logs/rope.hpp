@@ -0,0 +1,223 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+#include <algorithm>
+#include <type_traits>
+#include <functional>
+
+namespace fl {
+
+/*!
+ * Chunked text.
+ *
+ * Appending to a rope never moves the text accumulated so far: short pieces are copied into the spare capacity of
+ * the last chunk, long rvalue strings (and the first one) are adopted as new chunks. The text is flattened only when
+ * it's read with \p str() or \p flatten().
+ */
+class Rope {
+public:
+    using value_type = char;
+    using size_type = std::size_t;
+
+    /*!
+     * The minimal capacity of a newly allocated chunk.
+     */
+    static constexpr size_type chunk_size = 4096;
+
+    Rope() = default;
+
+    Rope(const char *s) : Rope(std::string_view(s)) {} // NOLINT
+    Rope(std::string_view s) { append(s); } // NOLINT
+    Rope(std::string s) { append(std::move(s)); } // NOLINT
+
+    Rope &append(const char *s) { return append(std::string_view(s)); }
+
+    Rope &append(std::string_view s) {
+        if (s.empty()) {
+            return *this;
+        }
+
+        if (tail_.capacity() - tail_.size() < s.size() && !tail_.empty()) {
+            seal();
+            tail_.reserve(std::max(chunk_size, s.size()));
+        }
+        tail_.append(s);
+        size_ += s.size();
+
+        return *this;
+    }
+
+    Rope &append(std::string &&s) {
+        if (s.size() <= tail_.capacity() - tail_.size() || (!tail_.empty() && s.size() < chunk_size / 2)) {
+            return append(std::string_view(s));
+        }
+
+        size_ += s.size();
+        seal();
+        tail_ = std::move(s);
+
+        return *this;
+    }
+
+    Rope &append(const Rope &r) {
+        if (&r == this) {
+            return append(Rope(r));
+        }
+
+        r.for_each_chunk([this](std::string_view c) { append(c); });
+
+        return *this;
+    }
+
+    Rope &append(Rope &&r) {
+        if (&r == this) {
+            return append(Rope(r));
+        }
+
+        if (empty()) {
+            return *this = std::move(r);
+        }
+
+        for (auto &c : r.sealed_) {
+            append(std::move(c));
+        }
+        append(std::move(r.tail_));
+        r.clear();
+
+        return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] size_type chunks_count() const noexcept { return sealed_.size() + (tail_.empty() ? 0 : 1); }
+
+    /*!
+     * Invoke \p f for each chunk of text in order. Can be used for draining the rope without flattening.
+     *
+     * @param f function that accepts std::string_view.
+     */
+    template <class F>
+    void for_each_chunk(F &&f) const {
+        for (const auto &c : sealed_) {
+            std::invoke(f, std::string_view(c));
+        }
+        if (!tail_.empty()) {
+            std::invoke(f, std::string_view(tail_));
+        }
+    }
+
+    /*!
+     * Get the whole text.
+     * @return a copy of the text as a single string.
+     */
+    [[nodiscard]] std::string str() const {
+        if (sealed_.empty()) {
+            return tail_;
+        }
+
+        std::string result;
+        result.reserve(size_);
+        for_each_chunk([&](std::string_view c) { result.append(c); });
+
+        return result;
+    }
+
+    /*!
+     * Merge all chunks into a single one.
+     * @return the whole text.
+     */
+    std::string_view flatten() {
+        if (!sealed_.empty()) {
+            tail_ = str();
+            sealed_.clear();
+        }
+
+        return tail_;
+    }
+
+    void clear() noexcept {
+        sealed_.clear();
+        tail_.clear();
+        size_ = 0;
+    }
+
+    template <class String>
+        requires (std::is_convertible_v<const String &, std::string_view> && !std::is_same_v<String, Rope>)
+    friend bool operator==(const Rope &lhs, const String &s) noexcept {
+        std::string_view rhs = s;
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        bool equal = true;
+        lhs.for_each_chunk([&](std::string_view c) {
+            equal = equal && rhs.starts_with(c);
+            rhs.remove_prefix(c.size());
+        });
+
+        return equal;
+    }
+
+    friend bool operator==(const Rope &lhs, const Rope &rhs) noexcept {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        size_type index = 0;
+        std::string_view current;
+        bool equal = true;
+        lhs.for_each_chunk([&](std::string_view c) {
+            while (equal && !c.empty()) {
+                while (current.empty()) {
+                    current = rhs.chunk(index++);
+                }
+
+                const auto n = std::min(c.size(), current.size());
+                equal = c.substr(0, n) == current.substr(0, n);
+                c.remove_prefix(n);
+                current.remove_prefix(n);
+            }
+        });
+
+        return equal;
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Rope &r) {
+        r.for_each_chunk([&](std::string_view c) { os << c; });
+
+        return os;
+    }
+
+private:
+    [[nodiscard]] std::string_view chunk(size_type index) const noexcept {
+        return index < sealed_.size() ? std::string_view(sealed_[index]) : std::string_view(tail_);
+    }
+
+    void seal() {
+        if (!tail_.empty()) {
+            sealed_.push_back(std::move(tail_));
+            tail_.clear();
+        }
+    }
+
+    std::vector<std::string> sealed_;
+    std::string tail_;
+    size_type size_ = 0;
+};
+
+} // namespace fl
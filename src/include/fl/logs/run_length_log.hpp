@@ -0,0 +1,216 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <vector>
+#include <compare>
+#include <concepts>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <fl/utils/attributes.hpp>
+
+namespace fl {
+
+/*!
+ * How run-length logs find duplicates.
+ */
+namespace dedup {
+
+/*!
+ * Only equal entries next to each other are collapsed, the log keeps the order of all entries.
+ */
+struct Consecutive {};
+
+/*!
+ * All equal entries are collapsed into the first one regardless of their positions. Entries are hashed.
+ */
+struct Global {};
+
+} // namespace dedup
+
+/*!
+ * Entry and the number of its repetitions.
+ */
+template <class T>
+struct Run {
+    T entry;
+    std::size_t count = 1;
+
+    auto operator<=>(const Run &) const = default;
+    bool operator==(const Run &) const = default;
+};
+
+/*!
+ * Log that collapses duplicate entries into runs.
+ *
+ * Loops that tell the same entry over and over keep a single run with a counter, so the log size is bounded by the
+ * number of distinct entries (or changes of entries with \p dedup::Consecutive). Runs are kept in the order of their
+ * first entries.
+ *
+ * @tparam T the type of entries.
+ * @tparam Mode the way of finding duplicates, see \p fl::dedup.
+ * @tparam Hash the hash of entries, used only by \p dedup::Global.
+ * @tparam Equal the comparison of entries, it's transparent by default, e.g. std::string entries are compared with
+ * string literals without creating strings.
+ */
+template <class T, class Mode = dedup::Consecutive, class Hash = std::hash<T>, class Equal = std::equal_to<>>
+class RunLengthLog {
+    static constexpr bool global = std::is_same_v<Mode, dedup::Global>;
+
+    struct NoIndex {};
+
+    // Hashes of entries to indices of runs, entries themselves are not duplicated
+    using Index = std::conditional_t<global, std::unordered_multimap<std::size_t, std::size_t>, NoIndex>;
+
+public:
+    using value_type = Run<T>;
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<Run<T>>::const_iterator;
+    using DedupMode = Mode;
+
+    RunLengthLog() = default;
+
+    RunLengthLog(std::initializer_list<T> entries) {
+        for (const auto &e : entries) {
+            add(e);
+        }
+    }
+
+    /*!
+     * Add \p count repetitions of \p entry.
+     */
+    template <class E>
+    requires std::constructible_from<T, E &&>
+    RunLengthLog &add(E &&entry, size_type count = 1) {
+        if (count == 0) {
+            return *this;
+        }
+
+        if constexpr (global) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<E>, T>) {
+                addGlobal(std::forward<E>(entry), count);
+            } else {
+                addGlobal(T(std::forward<E>(entry)), count);
+            }
+        } else if (!runs_.empty() && equal_(runs_.back().entry, entry)) {
+            runs_.back().count += count;
+        } else {
+            runs_.push_back({T(std::forward<E>(entry)), count});
+        }
+        entries_ += count;
+
+        return *this;
+    }
+
+    template <class E>
+    requires std::constructible_from<T, E &&>
+    void push_back(E &&entry) {
+        add(std::forward<E>(entry));
+    }
+
+    /*!
+     * Append runs of \p other, the adjacent runs are merged if their entries are equal.
+     */
+    template <class L>
+    requires std::same_as<std::remove_cvref_t<L>, RunLengthLog>
+    RunLengthLog &append(L &&other) {
+        if (this == &other) {
+            return append(RunLengthLog(std::as_const(other)));
+        }
+
+        if constexpr (std::is_same_v<L &&, RunLengthLog &&>) {
+            if (empty()) {
+                return *this = std::move(other);
+            }
+        }
+
+        for (auto &run : other.runs_) {
+            if constexpr (std::is_rvalue_reference_v<L &&>) {
+                add(std::move(run.entry), run.count);
+            } else {
+                add(run.entry, run.count);
+            }
+        }
+
+        return *this;
+    }
+
+    /*!
+     * The number of runs.
+     */
+    [[nodiscard]] size_type size() const noexcept { return runs_.size(); }
+
+    /*!
+     * The number of entries including repetitions.
+     */
+    [[nodiscard]] size_type entries_count() const noexcept { return entries_; }
+
+    [[nodiscard]] bool empty() const noexcept { return runs_.empty(); }
+
+    [[nodiscard]] const std::vector<Run<T>> &runs() const noexcept { return runs_; }
+
+    [[nodiscard]] const_iterator begin() const noexcept { return runs_.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return runs_.end(); }
+
+    void clear() noexcept {
+        runs_.clear();
+        entries_ = 0;
+        if constexpr (global) {
+            index_.clear();
+        }
+    }
+
+    friend bool operator==(const RunLengthLog &lhs, const RunLengthLog &rhs) { return lhs.runs_ == rhs.runs_; }
+
+private:
+    // Short logs, e.g. the ones created for a single entry, are scanned without hashing and allocating the index
+    static constexpr size_type linear_scan_limit = 8;
+
+    void addGlobal(T entry, size_type count) requires global {
+        if (runs_.size() <= linear_scan_limit) {
+            for (auto &run : runs_) {
+                if (equal_(run.entry, entry)) {
+                    run.count += count;
+                    return;
+                }
+            }
+        } else {
+            const auto hash = hash_(entry);
+            for (auto [it, end] = index_.equal_range(hash); it != end; ++it) {
+                if (auto &run = runs_[it->second]; equal_(run.entry, entry)) {
+                    run.count += count;
+                    return;
+                }
+            }
+        }
+
+        runs_.push_back({std::move(entry), count});
+        if (runs_.size() == linear_scan_limit + 1) {
+            for (size_type i = 0; i < runs_.size(); ++i) {
+                index_.emplace(hash_(runs_[i].entry), i);
+            }
+        } else if (runs_.size() > linear_scan_limit + 1) {
+            index_.emplace(hash_(runs_.back().entry), runs_.size() - 1);
+        }
+    }
+
+    std::vector<Run<T>> runs_;
+    size_type entries_ = 0;
+    FL_NO_UNIQUE_ADDRESS Index index_;
+    FL_NO_UNIQUE_ADDRESS Hash hash_;
+    FL_NO_UNIQUE_ADDRESS Equal equal_;
+};
+
+} // namespace fl
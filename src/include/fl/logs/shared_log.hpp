@@ -0,0 +1,258 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <functional>
+#include <type_traits>
+
+#include <fl/concepts/concepts.hpp>
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/monoids/monoid.hpp>
+
+namespace fl {
+
+template <class Log>
+class SharedLog;
+
+namespace _concepts {
+
+template <class V, class Log>
+concept AppendableToSharedLog =
+    concepts::Same<V, SharedLog<Log>> ||
+    concepts::CombinableInto<Semigroup<std::remove_cvref_t<Log>>, std::remove_cvref_t<Log>, V> ||
+    concepts::details::CombinableWithValue<Semigroup<std::remove_cvref_t<Log>>, std::remove_cvref_t<Log>, V>;
+
+} // namespace _concepts
+
+/*!
+ * Immutable log with structural sharing.
+ *
+ * The log is a tree of reference-counted segments. Copying is O(1), combining two shared logs creates a new node that
+ * refers to both of them. Segments are mutated in place only when this object is their sole owner, so branches made
+ * from the same base writer never observe each other's entries and never copy the common prefix.
+ *
+ * \p Semigroup<Log> and \p Monoid<Log> must exist, they are used for appending to segments and flattening.
+ *
+ * @tparam Log the type of underlying log, e.g. std::vector<std::string>.
+ */
+template <class Log>
+class SharedLog {
+public:
+    using LogType = std::remove_cvref_t<Log>;
+
+    SharedLog() = default;
+
+    SharedLog(LogType log) // NOLINT
+        : root_(NodePtr::make(std::move(log)))
+    {}
+
+    /*!
+     * Append \p v, which is either another shared log, or anything \p Semigroup<Log> can combine with \p Log.
+     *
+     * This is O(1) when the last segment is not shared; otherwise a new segment is created.
+     */
+    template <_concepts::AppendableToSharedLog<Log> V>
+    SharedLog &append(V &&v) {
+        if constexpr (std::is_same_v<std::remove_cvref_t<V>, SharedLog>) {
+            appendShared(std::forward<V>(v));
+        } else if (auto *tail = writableTail()) {
+            combine_into(Semigroup<LogType>(), tail->log, std::forward<V>(v));
+        } else {
+            appendNode(NodePtr::make(
+                details::combineMoved(Semigroup<LogType>(), Monoid<LogType>().identity(), std::forward<V>(v))));
+        }
+
+        return *this;
+    }
+
+    /*!
+     * Invoke \p f for each segment in order. Can be used for draining the log without flattening.
+     *
+     * @param f function that accepts const Log&.
+     */
+    template <class F>
+    void for_each_segment(F &&f) const {
+        if (!root_) {
+            return;
+        }
+
+        std::vector<const Node *> stack{root_.get()};
+        while (!stack.empty()) {
+            const auto *node = stack.back();
+            stack.pop_back();
+
+            if (node->leaf()) {
+                std::invoke(f, node->log);
+            } else {
+                stack.push_back(node->right.get());
+                stack.push_back(node->left.get());
+            }
+        }
+    }
+
+    /*!
+     * Get the whole log.
+     * @return a copy of all segments combined.
+     */
+    [[nodiscard]] LogType flatten() const {
+        if (root_ && root_->leaf()) {
+            return root_->log;
+        }
+
+        auto result = Monoid<LogType>().identity();
+        for_each_segment([&](const LogType &l) { combine_into(Semigroup<LogType>(), result, l); });
+        return result;
+    }
+
+    /*!
+     * Check if this object is the only owner of the log. Shared logs are never mutated in place.
+     */
+    [[nodiscard]] bool unique() const noexcept { return !root_ || root_.unique(); }
+
+    [[nodiscard]] bool empty() const noexcept { return !root_; }
+
+    friend bool operator==(const SharedLog &lhs, const SharedLog &rhs) {
+        return lhs.root_ == rhs.root_ || lhs.flatten() == rhs.flatten();
+    }
+
+private:
+    struct Node;
+
+    // Intrusively counted owner of a node. unique() is an acquire load, so a segment that other threads have stopped
+    // sharing is appended to only after they are done reading it.
+    class NodePtr {
+    public:
+        NodePtr() = default;
+
+        template <class... Args>
+        [[nodiscard]] static NodePtr make(Args &&...args) {
+            NodePtr result;
+            result.node_ = new Node(std::forward<Args>(args)...);
+            return result;
+        }
+
+        NodePtr(const NodePtr &other) noexcept : node_(other.node_) {
+            if (node_) {
+                node_->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        NodePtr(NodePtr &&other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+
+        NodePtr &operator=(NodePtr other) noexcept {
+            std::swap(node_, other.node_);
+            return *this;
+        }
+
+        ~NodePtr() { reset(); }
+
+        void reset() noexcept {
+            if (auto *node = std::exchange(node_, nullptr);
+                node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete node;
+            }
+        }
+
+        [[nodiscard]] bool unique() const noexcept { return node_->refs.load(std::memory_order_acquire) == 1; }
+
+        [[nodiscard]] Node *get() const noexcept { return node_; }
+        Node *operator->() const noexcept { return node_; }
+        Node &operator*() const noexcept { return *node_; }
+        explicit operator bool() const noexcept { return node_ != nullptr; }
+
+        friend bool operator==(const NodePtr &, const NodePtr &) = default;
+
+    private:
+        Node *node_ = nullptr;
+    };
+
+    struct Node {
+        explicit Node(LogType l) : log(std::move(l)) {}
+        Node(NodePtr l, NodePtr r) : left(std::move(l)), right(std::move(r)) {}
+
+        Node(const Node &) = delete;
+        Node &operator=(const Node &) = delete;
+
+        // Deep trees are released iteratively
+        ~Node() {
+            std::vector<NodePtr> stack;
+            const auto release = [&](NodePtr &n) {
+                if (n && n.unique()) {
+                    stack.push_back(std::move(n));
+                }
+            };
+
+            release(left);
+            release(right);
+            while (!stack.empty()) {
+                auto n = std::move(stack.back());
+                stack.pop_back();
+                release(n->left);
+                release(n->right);
+            }
+        }
+
+        [[nodiscard]] bool leaf() const noexcept { return !left; }
+
+        LogType log;
+        NodePtr left;
+        NodePtr right;
+        std::atomic<std::size_t> refs{1};
+    };
+
+    Node *writableTail() const noexcept {
+        auto *node = root_.get();
+        if (!node || !root_.unique()) {
+            return nullptr;
+        }
+
+        while (!node->leaf()) {
+            if (!node->right.unique()) {
+                return nullptr;
+            }
+            node = node->right.get();
+        }
+
+        return node;
+    }
+
+    void appendNode(NodePtr node) {
+        root_ = root_ ? NodePtr::make(std::move(root_), std::move(node)) : std::move(node);
+    }
+
+    void appendShared(concepts::Same<SharedLog> auto &&other) {
+        if (!other.root_) {
+            return;
+        }
+
+        if (!root_) {
+            root_ = std::forward<decltype(other)>(other).root_;
+            return;
+        }
+
+        // Entries are moved only out of a segment nobody else refers to, everything else is shared
+        const bool steal = std::is_rvalue_reference_v<decltype(other)> && other.root_->leaf() && other.unique();
+        auto *tail = steal ? writableTail() : nullptr;
+        if (tail) {
+            combine_into(Semigroup<LogType>(), tail->log, std::move(other.root_->log));
+        } else {
+            appendNode(std::forward<decltype(other)>(other).root_);
+        }
+    }
+
+    NodePtr root_;
+};
+
+} // namespace fl
@@ -0,0 +1,206 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fl {
+
+/*!
+ * Estimate of quantiles of a stream of numbers, e.g. request durations, in bounded memory.
+ *
+ * Samples are clustered into centroids, and centroids near the tails are kept small, so extreme quantiles like p99
+ * and p999 are more accurate than the median. There are at most about \p Compression centroids, usually about half as
+ * many. Digests are merged by
+ * clustering centroids of both digests together. It's approximately associative: the result depends a bit on the
+ * order of merges, but the error stays bounded.
+ *
+ * @tparam Compression the accuracy and the size of the digest.
+ */
+template <std::size_t Compression = 100>
+requires (Compression >= 10)
+class TDigest {
+public:
+    using value_type = double;
+    using size_type = std::size_t;
+
+    struct Centroid {
+        double mean;
+        double weight;
+
+        bool operator==(const Centroid &) const = default;
+    };
+
+    static constexpr size_type compression = Compression;
+
+    TDigest() = default;
+
+    TDigest &add(double sample, double weight = 1.0) {
+        buffer_.push_back({sample, weight});
+        total_ += weight;
+        min_ = std::min(min_, sample);
+        max_ = std::max(max_, sample);
+
+        if (buffer_.size() >= buffer_limit) {
+            compress();
+        }
+
+        return *this;
+    }
+
+    template <class D>
+    requires std::same_as<std::remove_cvref_t<D>, TDigest>
+    TDigest &merge(D &&other) {
+        if (other.empty()) {
+            return *this;
+        }
+
+        if (&other == this) {
+            return merge(TDigest(other));
+        }
+
+        total_ += other.total_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+        buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+        buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+        compress();
+
+        return *this;
+    }
+
+    /*!
+     * Cluster buffered samples into centroids. It's called automatically, but can be used to shrink the digest
+     * before storing it.
+     */
+    void compress() {
+        if (buffer_.empty()) {
+            return;
+        }
+
+        buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+        std::sort(buffer_.begin(), buffer_.end(), [](const auto &a, const auto &b) { return a.mean < b.mean; });
+
+        centroids_.clear();
+        auto current = buffer_.front();
+        double before = 0.0;
+        double limit = quantileLimit(0.0);
+        for (auto it = std::next(buffer_.begin()); it != buffer_.end(); ++it) {
+            const double proposed = current.weight + it->weight;
+
+            if ((before + proposed) / total_ <= limit) {
+                current.mean += (it->mean - current.mean) * it->weight / proposed;
+                current.weight = proposed;
+            } else {
+                before += current.weight;
+                limit = quantileLimit(before / total_);
+                centroids_.push_back(current);
+                current = *it;
+            }
+        }
+        centroids_.push_back(current);
+        buffer_.clear();
+    }
+
+    /*!
+     * The estimated value of the quantile \p q, from 0 to 1. NaN if there are no samples.
+     */
+    [[nodiscard]]
+    double quantile(double q) const {
+        if (empty()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+
+        if (!buffer_.empty()) {
+            auto compressed = *this;
+            compressed.compress();
+            return compressed.quantile(q);
+        }
+
+        q = std::clamp(q, 0.0, 1.0);
+        if (centroids_.size() == 1) {
+            return centroids_.front().mean;
+        }
+
+        const double target = q * total_;
+        const auto &first = centroids_.front();
+        if (target < first.weight / 2.0) {
+            return min_ + (first.mean - min_) * target / (first.weight / 2.0);
+        }
+
+        const auto &last = centroids_.back();
+        if (target > total_ - last.weight / 2.0) {
+            return max_ - (max_ - last.mean) * (total_ - target) / (last.weight / 2.0);
+        }
+
+        // Samples of a centroid are spread around its mean, so values are interpolated between adjacent means
+        double center = first.weight / 2.0;
+        for (size_type i = 0; i + 1 < centroids_.size(); ++i) {
+            const double gap = (centroids_[i].weight + centroids_[i + 1].weight) / 2.0;
+            if (target <= center + gap) {
+                const double m1 = centroids_[i].mean;
+                return m1 + (centroids_[i + 1].mean - m1) * (target - center) / gap;
+            }
+            center += gap;
+        }
+
+        return last.mean;
+    }
+
+    /*!
+     * The total weight of samples.
+     */
+    [[nodiscard]] double total() const noexcept { return total_; }
+
+    [[nodiscard]] bool empty() const noexcept { return total_ == 0.0; }
+
+    [[nodiscard]] double min() const noexcept { return min_; }
+
+    [[nodiscard]] double max() const noexcept { return max_; }
+
+    /*!
+     * Centroids ordered by their means, without buffered samples.
+     */
+    [[nodiscard]] const std::vector<Centroid> &centroids() const noexcept { return centroids_; }
+
+private:
+    // A centroid that starts at the quantile q can grow up to the returned quantile. The limit follows the scale
+    // function k(q) = Compression / (2 * pi) * asin(2q - 1), so centroids are small near the tails. k spans
+    // Compression / 2 units, and two adjacent centroids cover at least one unit, hence at most about Compression
+    // centroids.
+    [[nodiscard]]
+    static double quantileLimit(double q) noexcept {
+        constexpr double pi = std::numbers::pi;
+        constexpr double scale = double(Compression) / (2.0 * pi);
+        const double k = scale * std::asin(std::clamp(2.0 * q - 1.0, -1.0, 1.0)) + 1.0;
+        return k >= scale * pi / 2.0 ? 1.0 : (std::sin(k / scale) + 1.0) / 2.0;
+    }
+
+    // Samples are sorted in batches, which is cheaper than inserting them one by one
+    static constexpr size_type buffer_limit = 5 * Compression;
+
+    std::vector<Centroid> centroids_;
+    std::vector<Centroid> buffer_;
+    double total_ = 0.0;
+    double min_ = std::numeric_limits<double>::max();
+    double max_ = std::numeric_limits<double>::lowest();
+};
+
+} // namespace fl
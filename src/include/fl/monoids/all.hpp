@@ -11,3 +11,4 @@
 #pragma once
 
 #include <fl/monoids/monoid_default_constructable.hpp>
+#include <fl/monoids/mconcat.hpp>
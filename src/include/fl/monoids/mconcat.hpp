@@ -0,0 +1,69 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include <fl/monoids/monoid_default_constructable.hpp>
+#include <fl/semigroups/semigroup.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class M, class T>
+concept Reserving = std::ranges::sized_range<const T> && requires(const M &m, T &acc, std::size_t size) {
+    m.reserve(acc, size);
+};
+
+} // namespace _concepts
+
+/*!
+ * Combine all \p logs in order, the identity is returned for an empty range.
+ *
+ * If the monoid has \p reserve(T& acc, std::size_t size), e.g. for strings and containers, the total size of logs is
+ * reserved once before they are combined. Logs of an owning rvalue range, e.g. std::vector, are moved.
+ * \code{.cpp}
+ *    const auto log = fl::mconcat(std::vector<std::string>{"a", "b", "c"}); // "abc"
+ * \endcode
+ */
+template <std::ranges::input_range R, class T = std::remove_cvref_t<std::ranges::range_reference_t<R>>>
+[[nodiscard]]
+T mconcat(R &&logs) {
+    const Monoid<T> m;
+    T result = m.identity();
+
+    if constexpr (std::ranges::forward_range<R> && _concepts::Reserving<Monoid<T>, T>) {
+        std::size_t size = 0;
+        for (const auto &l : logs) {
+            size += std::ranges::size(l);
+        }
+        m.reserve(result, size);
+    }
+
+    // Views and borrowed ranges refer to logs owned by someone else
+    constexpr bool moveLogs = !std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>> &&
+                              !std::ranges::borrowed_range<R>;
+    for (auto &&l : logs) {
+        if constexpr (moveLogs && !std::is_const_v<std::remove_reference_t<decltype(l)>>) {
+            combine_into(m, result, std::move(l));
+        } else {
+            combine_into(m, result, std::forward<decltype(l)>(l));
+        }
+    }
+
+    return result;
+}
+
+} // namespace fl
@@ -13,6 +13,7 @@
 #include <fl/monoids/monoid.hpp>
 
 #include <type_traits>
+#include <concepts>
 
 namespace fl {
 
@@ -26,9 +27,19 @@ concept DefaultConstructable = requires {
 template<_concepts::DefaultConstructable T>
 struct Monoid<T> : public Semigroup<T> {
     [[nodiscard]]
-    T identity() const {
+    constexpr T identity() const {
         return T{};
     }
+
+    /*!
+     * Identity that uses \p alloc, e.g. for logs with std::pmr allocators.
+     */
+    template <class Allocator>
+    requires std::constructible_from<T, const Allocator &>
+    [[nodiscard]]
+    T identity(const Allocator &alloc) const {
+        return T(alloc);
+    }
 };
 
 } // namespace fl
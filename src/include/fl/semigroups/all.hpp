@@ -12,4 +12,20 @@
 
 #include <fl/semigroups/semigroup_string.hpp>
 #include <fl/semigroups/semigroup_addable.hpp>
-#include <fl/semigroups/semigroup_std_container.hpp>
\ No newline at end of file
+#include <fl/semigroups/semigroup_std_container.hpp>
+#include <fl/semigroups/semigroup_rope.hpp>
+#include <fl/semigroups/semigroup_shared_log.hpp>
+#include <fl/semigroups/semigroup_chunked_log.hpp>
+#include <fl/semigroups/semigroup_null_log.hpp>
+#include <fl/semigroups/semigroup_merge_map.hpp>
+#include <fl/semigroups/semigroup_inline_vector.hpp>
+#include <fl/semigroups/semigroup_flat_string_log.hpp>
+#include <fl/semigroups/semigroup_run_length_log.hpp>
+#include <fl/semigroups/semigroup_ring_log.hpp>
+#include <fl/semigroups/semigroup_budget_log.hpp>
+#include <fl/semigroups/semigroup_compacting_log.hpp>
+#include <fl/semigroups/semigroup_product.hpp>
+#include <fl/semigroups/semigroup_elementwise.hpp>
+#include <fl/semigroups/semigroup_metrics.hpp>
+#include <fl/semigroups/semigroup_sketches.hpp>
+#include <fl/semigroups/semigroup_persistent_map.hpp>
\ No newline at end of file
@@ -12,48 +12,222 @@
 
 #include <fl/concepts/concepts.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fl
 {
 
+/*!
+ * Type-erased semigroup of \p Log.
+ *
+ * Semigroups that are small enough and nothrow movable, e.g. stateless ones, are stored inline, so creating and
+ * copying the wrapper never allocates. Larger semigroups are stored on the heap. Calls go through a table of function
+ * pointers that is shared by all wrappers of the same semigroup type.
+ *
+ * If the semigroup has \p combine_into, appending through the wrapper is done in place as well. Batches of logs are
+ * combined by \p combine_many with a single indirect call, e.g. by \p Writer::tell_all.
+ *
+ * Moving a wrapper with a heap-stored semigroup takes the semigroup over, so a moved-from wrapper may only be assigned
+ * to or destroyed.
+ */
 template<class Log>
 struct SemigroupWrapper
 {
+    /*!
+     * The size of the inline storage.
+     */
+    static constexpr std::size_t inline_size = 2 * sizeof(void *);
+
+    /*!
+     * Whether the semigroup \p S is stored inline.
+     */
+    template<class S>
+    static constexpr bool stores_inline =
+        sizeof(S) <= inline_size && alignof(S) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<S>;
+
     template<class SemigroupImpl>
     SemigroupWrapper(SemigroupImpl &&semigroupImpl) // NOLINT
     requires (fl::concepts::IsProbablySemigroup<SemigroupImpl> &&
+              std::is_copy_constructible_v<std::remove_cvref_t<SemigroupImpl>> &&
               !std::is_same_v<std::remove_cvref_t<SemigroupImpl>, SemigroupWrapper<Log>>)
-        : semigroupModel(std::make_unique<SemigroupModel<SemigroupImpl>>(std::forward<SemigroupImpl>(semigroupImpl)))
-    {}
+        : table_(&tableFor<std::remove_cvref_t<SemigroupImpl>>)
+    {
+        using Impl = std::remove_cvref_t<SemigroupImpl>;
+        if constexpr (stores_inline<Impl>) {
+            ::new (static_cast<void *>(storage_)) Impl(std::forward<SemigroupImpl>(semigroupImpl));
+        } else {
+            ::new (static_cast<void *>(storage_)) Impl *(new Impl(std::forward<SemigroupImpl>(semigroupImpl)));
+        }
+    }
+
+    SemigroupWrapper(const SemigroupWrapper &other)
+        : table_(other.table_)
+    { table_->copy(storage_, other.storage_); }
+
+    SemigroupWrapper(SemigroupWrapper &&other) noexcept
+        : table_(other.table_)
+    { table_->move(storage_, other.storage_); }
+
+    SemigroupWrapper &operator=(const SemigroupWrapper &other)
+    {
+        if (this != &other) {
+            SemigroupWrapper copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    SemigroupWrapper &operator=(SemigroupWrapper &&other) noexcept
+    {
+        if (this != &other) {
+            table_->destroy(storage_);
+            table_ = other.table_;
+            table_->move(storage_, other.storage_);
+        }
+        return *this;
+    }
+
+    ~SemigroupWrapper() { table_->destroy(storage_); }
 
     Log combine(concepts::SameOrConstructable<Log> auto &&l1, concepts::SameOrConstructable<Log> auto &&l2) const
-    { return semigroupModel->combineImpl(std::forward<decltype(l1)>(l1), std::forward<decltype(l2)>(l2)); }
+    { return combineImpl(std::forward<decltype(l1)>(l1), std::forward<decltype(l2)>(l2)); }
+
+    void combine_into(Log &acc, concepts::SameOrConstructable<Log> auto &&l) const
+    { combineIntoImpl(acc, std::forward<decltype(l)>(l)); }
 
-    struct SemigroupConcept
+    /*!
+     * Combine all \p logs into \p acc in order with a single indirect call.
+     *
+     * The semigroup can provide the member function \p combine_many(Log& acc, std::span<const Log> logs), e.g. for
+     * reserving memory once. Otherwise logs are combined one by one, in place if possible.
+     */
+    void combine_many(Log &acc, std::span<const Log> logs) const
+    { table_->combineMany(storage_, acc, logs); }
+
+private:
+    struct Table
     {
-        virtual ~SemigroupConcept() = default;
-        virtual Log combineImpl(const Log &l1, const Log &l2) const = 0;
-        virtual Log combineImpl(const Log &l1, Log &&l2) const = 0;
-        virtual Log combineImpl(Log &&l1, const Log &l2) const = 0;
-        virtual Log combineImpl(Log &&l1, Log &&l2) const = 0;
+        Log (*combineCC)(const std::byte *, const Log &, const Log &);
+        Log (*combineCM)(const std::byte *, const Log &, Log &&);
+        Log (*combineMC)(const std::byte *, Log &&, const Log &);
+        Log (*combineMM)(const std::byte *, Log &&, Log &&);
+        void (*combineIntoC)(const std::byte *, Log &, const Log &);
+        void (*combineIntoM)(const std::byte *, Log &, Log &&);
+        void (*combineMany)(const std::byte *, Log &, std::span<const Log>);
+        void (*copy)(std::byte *, const std::byte *);
+        void (*move)(std::byte *, std::byte *) noexcept;
+        void (*destroy)(std::byte *) noexcept;
     };
 
-    template<fl::concepts::IsProbablySemigroup SemigroupImpl>
-    struct SemigroupModel final: SemigroupConcept
+    template<class Impl>
+    static const Impl &get(const std::byte *storage) noexcept
     {
-        SemigroupModel(concepts::SameOrConstructable<SemigroupImpl> auto &&si) // NOLINT
-            : semigroupImpl(std::forward<decltype(si)>(si)) {}
+        if constexpr (stores_inline<Impl>) {
+            return *std::launder(reinterpret_cast<const Impl *>(storage));
+        } else {
+            return **std::launder(reinterpret_cast<Impl *const *>(storage));
+        }
+    }
 
-        Log combineImpl(const Log &l1, const Log &l2) const override { return semigroupImpl.combine(l1, l2); }
-        Log combineImpl(const Log &l1, Log &&l2) const override { return semigroupImpl.combine(l1, std::move(l2)); }
-        Log combineImpl(Log &&l1, const Log &l2) const override { return semigroupImpl.combine(std::move(l1), l2); }
-        Log combineImpl(Log &&l1, Log &&l2) const override { return semigroupImpl.combine(std::move(l1), std::move(l2)); }
+    template<class Impl, class L>
+    static void combineIntoWith(const std::byte *storage, Log &acc, L &&l)
+    {
+        const auto &impl = get<Impl>(storage);
+        if constexpr (concepts::CombinableInto<Impl, Log, L>) {
+            impl.combine_into(acc, std::forward<L>(l));
+        } else {
+            acc = impl.combine(std::move(acc), std::forward<L>(l));
+        }
+    }
 
-        SemigroupImpl semigroupImpl;
+    template<class Impl>
+    static void combineManyWith(const std::byte *storage, Log &acc, std::span<const Log> logs)
+    {
+        if constexpr (requires(const Impl &impl) { impl.combine_many(acc, logs); }) {
+            get<Impl>(storage).combine_many(acc, logs);
+        } else {
+            for (const auto &l : logs) {
+                combineIntoWith<Impl>(storage, acc, l);
+            }
+        }
+    }
+
+    template<class Impl>
+    static constexpr Table tableFor{
+        [](const std::byte *s, const Log &l1, const Log &l2) { return Log(get<Impl>(s).combine(l1, l2)); },
+        [](const std::byte *s, const Log &l1, Log &&l2) { return Log(get<Impl>(s).combine(l1, std::move(l2))); },
+        [](const std::byte *s, Log &&l1, const Log &l2) { return Log(get<Impl>(s).combine(std::move(l1), l2)); },
+        [](const std::byte *s, Log &&l1, Log &&l2) {
+            return Log(get<Impl>(s).combine(std::move(l1), std::move(l2)));
+        },
+        [](const std::byte *s, Log &acc, const Log &l) { combineIntoWith<Impl>(s, acc, l); },
+        [](const std::byte *s, Log &acc, Log &&l) { combineIntoWith<Impl>(s, acc, std::move(l)); },
+        [](const std::byte *s, Log &acc, std::span<const Log> logs) { combineManyWith<Impl>(s, acc, logs); },
+        [](std::byte *dst, const std::byte *src) {
+            if constexpr (stores_inline<Impl>) {
+                ::new (static_cast<void *>(dst)) Impl(get<Impl>(src));
+            } else {
+                ::new (static_cast<void *>(dst)) Impl *(new Impl(get<Impl>(src)));
+            }
+        },
+        [](std::byte *dst, std::byte *src) noexcept {
+            if constexpr (stores_inline<Impl>) {
+                ::new (static_cast<void *>(dst)) Impl(std::move(*std::launder(reinterpret_cast<Impl *>(src))));
+            } else {
+                // The heap object is taken over, the source is left empty
+                ::new (static_cast<void *>(dst)) Impl *(std::exchange(*std::launder(reinterpret_cast<Impl **>(src)),
+                                                                      nullptr));
+            }
+        },
+        [](std::byte *s) noexcept {
+            if constexpr (stores_inline<Impl>) {
+                std::launder(reinterpret_cast<Impl *>(s))->~Impl();
+            } else {
+                delete *std::launder(reinterpret_cast<Impl **>(s));
+            }
+        },
     };
 
-    std::unique_ptr<SemigroupConcept> semigroupModel;
+    Log combineImpl(const Log &l1, const Log &l2) const { return table_->combineCC(storage_, l1, l2); }
+    Log combineImpl(const Log &l1, Log &&l2) const { return table_->combineCM(storage_, l1, std::move(l2)); }
+    Log combineImpl(Log &&l1, const Log &l2) const { return table_->combineMC(storage_, std::move(l1), l2); }
+    Log combineImpl(Log &&l1, Log &&l2) const { return table_->combineMM(storage_, std::move(l1), std::move(l2)); }
+
+    void combineIntoImpl(Log &acc, const Log &l) const { table_->combineIntoC(storage_, acc, l); }
+    void combineIntoImpl(Log &acc, Log &&l) const { table_->combineIntoM(storage_, acc, std::move(l)); }
+
+    const Table *table_;
+    alignas(std::max_align_t) std::byte storage_[inline_size];
 };
 
-} // namespace fl
\ No newline at end of file
+namespace details {
+
+// Logs stored contiguously are passed as is, other entries are converted to logs first
+template<class Log, std::ranges::input_range R>
+void combineRange(const SemigroupWrapper<Log> &sg, Log &acc, R &&entries)
+{
+    using Entry = std::ranges::range_value_t<R>;
+    if constexpr (std::ranges::contiguous_range<R> && std::is_same_v<Entry, Log>) {
+        sg.combine_many(acc, std::span<const Log>(std::ranges::data(entries), std::ranges::size(entries)));
+    } else {
+        std::vector<Log> logs;
+        if constexpr (std::ranges::sized_range<R>) {
+            logs.reserve(std::ranges::size(entries));
+        }
+        for (auto &&e : entries) {
+            logs.emplace_back(std::forward<decltype(e)>(e));
+        }
+        sg.combine_many(acc, logs);
+    }
+}
+
+} // namespace details
+
+} // namespace fl
@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <deque>
+#include <list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <fl/concepts/concepts.hpp>
+#include <fl/semigroups/growth_policy.hpp>
+
+namespace fl {
+
+/*!
+ * Customization point for containers that don't meet the requirements of the container semigroups, or need
+ * a better way of appending, e.g. std::list, std::deque, small or flat vectors from other libraries.
+ *
+ * A specialization provides static functions:
+ *  - append(C &acc, const C &c) and, optionally, append(C &acc, C &&c) -- add all elements of \p c to the end;
+ *  - push_back(C &acc, V &&value) -- add a single element;
+ *  - splice(C &acc, C &&c) -- optional, transfer elements of an rvalue without copying or moving them;
+ *  - reserve(C &acc, std::size_t size) -- optional, prepare \p acc for \p size elements.
+ *
+ * Containers with a specialization get \p Semigroup and can be used as \p Writer logs:
+ * \code{.cpp}
+ *    template <class T, std::size_t N>
+ *    struct fl::container_traits<boost::container::small_vector<T, N>>
+ *        : fl::sequence_container_traits<boost::container::small_vector<T, N>> {};
+ * \endcode
+ */
+template <class Container>
+struct container_traits {};
+
+/*!
+ * Traits for containers with insert(pos, first, last) and emplace_back. It can be used as a base of specializations.
+ */
+template <class Container>
+struct sequence_container_traits {
+    static void append(Container &acc, const Container &c) { acc.insert(std::end(acc), std::begin(c), std::end(c)); }
+
+    static void append(Container &acc, Container &&c) {
+        acc.insert(std::end(acc), std::make_move_iterator(std::begin(c)), std::make_move_iterator(std::end(c)));
+    }
+
+    template <class V>
+    static void push_back(Container &acc, V &&value) {
+        acc.emplace_back(std::forward<V>(value));
+    }
+
+    static void reserve(Container &acc, std::size_t size) requires requires { acc.reserve(size); } {
+        if constexpr (requires { { acc.capacity() } -> std::convertible_to<std::size_t>; }) {
+            if (acc.capacity() < size) {
+                acc.reserve(growth_policy_t<Container>::capacity(acc.capacity(), size));
+            }
+        } else {
+            acc.reserve(size);
+        }
+    }
+};
+
+template <class T, class Allocator>
+struct container_traits<std::deque<T, Allocator>> : sequence_container_traits<std::deque<T, Allocator>> {};
+
+template <class T, class Allocator>
+struct container_traits<std::list<T, Allocator>> : sequence_container_traits<std::list<T, Allocator>> {
+    // Nodes are relinked in O(1), it's only possible between lists with equal allocators
+    static void splice(std::list<T, Allocator> &acc, std::list<T, Allocator> &&c) {
+        if (acc.get_allocator() == c.get_allocator()) {
+            acc.splice(acc.end(), c);
+        } else {
+            sequence_container_traits<std::list<T, Allocator>>::append(acc, std::move(c));
+        }
+    }
+};
+
+namespace concepts {
+
+/*!
+ * Containers with a \p container_traits specialization.
+ */
+template <class Container, class C = std::remove_cvref_t<Container>>
+concept CustomizedContainer = requires(C &acc, const C &c, typename C::value_type &&v) {
+    container_traits<C>::append(acc, c);
+    container_traits<C>::push_back(acc, std::move(v));
+};
+
+} // namespace concepts
+
+namespace details {
+
+template <class C>
+constexpr void traitsAppend(C &acc, concepts::Same<C> auto &&c) {
+    using Traits = container_traits<C>;
+    if constexpr (std::is_rvalue_reference_v<decltype(c)> && !std::is_const_v<std::remove_reference_t<decltype(c)>> &&
+                  requires { Traits::splice(acc, std::move(c)); }) {
+        Traits::splice(acc, std::move(c));
+    } else {
+        if constexpr (requires { Traits::reserve(acc, acc.size()); c.size(); }) {
+            Traits::reserve(acc, acc.size() + c.size());
+        }
+        Traits::append(acc, std::forward<decltype(c)>(c));
+    }
+}
+
+} // namespace details
+
+} // namespace fl
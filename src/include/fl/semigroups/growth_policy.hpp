@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace fl {
+
+/*!
+ * Growth policies for container logs.
+ *
+ * A policy computes the capacity to reserve when a log of \p current capacity must fit \p required elements.
+ */
+namespace growth {
+
+/*!
+ * Reserve exactly as much as required. Repeated combines reallocate every time.
+ */
+struct Exact {
+    [[nodiscard]]
+    static constexpr std::size_t capacity(std::size_t, std::size_t required) noexcept { return required; }
+};
+
+/*!
+ * Multiply the current capacity by \p Num / \p Den, or reserve as much as required if it's bigger.
+ */
+template <std::size_t Num, std::size_t Den = 1>
+struct Factor {
+    static_assert(Num > Den, "Capacity must grow");
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity(std::size_t current, std::size_t required) noexcept {
+        return std::max(required, current / Den * Num + current % Den * Num / Den);
+    }
+};
+
+/*!
+ * Round the required capacity up to a multiple of \p N.
+ */
+template <std::size_t N>
+struct Chunked {
+    static_assert(N > 0, "Chunk must not be empty");
+
+    [[nodiscard]]
+    static constexpr std::size_t capacity(std::size_t, std::size_t required) noexcept {
+        return (required + N - 1) / N * N;
+    }
+};
+
+using Geometric = Factor<2>;
+
+} // namespace growth
+
+/*!
+ * Growth policy used by the container semigroups for the log type \p Container.
+ *
+ * Specialize it to change the policy for your log type:
+ * \code{.cpp}
+ *    struct Log : std::vector<std::string> { using std::vector<std::string>::vector; };
+ *
+ *    template <>
+ *    struct fl::growth_policy<Log> { using type = fl::growth::Chunked<1024>; };
+ * \endcode
+ */
+template <class Container>
+struct growth_policy {
+    using type = growth::Geometric;
+};
+
+template <class Container>
+using growth_policy_t = typename growth_policy<std::remove_cvref_t<Container>>::type;
+
+} // namespace fl
@@ -10,6 +10,11 @@
 //
 #pragma once
 
+#include <utility>
+#include <type_traits>
+
+#include <fl/concepts/concepts.hpp>
+
 namespace fl {
 template<class T>
 struct Semigroup {
@@ -25,4 +30,35 @@ struct Semigroup {
     [[nodiscard]]
     T combine(T&& v1, const T& v2) const;
 };
+
+/*!
+ * Combine \p v into the accumulator \p acc in place.
+ *
+ * A semigroup can provide the member function \p combine_into(T& acc, V&& v) that appends to \p acc without creating
+ * a new object. Otherwise this function falls back to \p acc = s.combine(std::move(acc), v).
+ */
+template<class S, class T, class V>
+constexpr void combine_into(const S &s, T &acc, V &&v) {
+    if constexpr (concepts::CombinableInto<S, T, V>) {
+        s.combine_into(acc, std::forward<V>(v));
+    } else {
+        acc = s.combine(std::move(acc), std::forward<V>(v));
+    }
+}
+
+namespace details {
+
+// Combine an rvalue accumulator, in place if the semigroup supports it.
+template<class S, class T, class V>
+constexpr T combineMoved(const S &s, T &&acc, V &&v) requires (!std::is_lvalue_reference_v<T>) {
+    if constexpr (concepts::CombinableInto<S, T, V>) {
+        s.combine_into(acc, std::forward<V>(v));
+        return std::move(acc);
+    } else {
+        return s.combine(std::move(acc), std::forward<V>(v));
+    }
+}
+
+} // namespace details
+
 } // namespace fl
\ No newline at end of file
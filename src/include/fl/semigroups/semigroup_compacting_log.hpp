@@ -0,0 +1,55 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/logs/compacting_log.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class E, class Log>
+concept CompactingLogEntry = !concepts::Same<E, Log> && AppendableToCompactingLog<E, Log>;
+
+} // namespace _concepts
+
+template<class Log, class Compactor, std::size_t Threshold>
+struct Semigroup<CompactingLog<Log, Compactor, Threshold>> {
+    using Compacting = CompactingLog<Log, Compactor, Threshold>;
+
+    [[nodiscard]]
+    Compacting combine(concepts::Same<Compacting> auto &&v1, concepts::Same<Compacting> auto &&v2) const {
+        Compacting result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]]
+    Compacting combine(concepts::Same<Compacting> auto &&log,
+                       _concepts::CompactingLogEntry<Compacting> auto &&e) const {
+        Compacting result = details::moveOrCopy(std::forward<decltype(log)>(log));
+        result.append(std::forward<decltype(e)>(e));
+        return result;
+    }
+
+    void combine_into(Compacting &acc, concepts::Same<Compacting> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+
+    void combine_into(Compacting &acc, _concepts::CompactingLogEntry<Compacting> auto &&e) const {
+        acc.append(std::forward<decltype(e)>(e));
+    }
+};
+
+} // namespace fl
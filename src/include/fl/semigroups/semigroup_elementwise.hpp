@@ -0,0 +1,112 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <valarray>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/utils/attributes.hpp>
+
+namespace fl {
+
+namespace details {
+
+// Arrays are added in blocks of a fixed size. GCC vectorizes such blocks even at -O2, where loops that need a scalar
+// epilogue are not vectorized, and FL_RESTRICT removes runtime overlap checks. The tail is added one by one.
+template <class T>
+constexpr void addElementwise(T *FL_RESTRICT acc, const T *FL_RESTRICT v, std::size_t size) noexcept {
+    // An array combined with itself, the pointers must not be used together
+    if (acc == v) {
+        for (std::size_t i = 0; i < size; ++i) {
+            acc[i] += acc[i];
+        }
+        return;
+    }
+
+    constexpr std::size_t block = std::max<std::size_t>(64 / sizeof(T), 1);
+    std::size_t i = 0;
+    for (; i + block <= size; i += block) {
+        for (std::size_t j = 0; j < block; ++j) {
+            acc[i + j] += v[i + j];
+        }
+    }
+    for (; i < size; ++i) {
+        acc[i] += v[i];
+    }
+}
+
+} // namespace details
+
+/*!
+ * Arrays are combined element-wise, e.g. buckets of histograms. Elements are combined with their own semigroup,
+ * arithmetic elements are added.
+ */
+template <class T, std::size_t N>
+struct Semigroup<std::array<T, N>> {
+    using Array = std::array<T, N>;
+
+    [[nodiscard]]
+    constexpr Array combine(concepts::Same<Array> auto &&v1, concepts::Same<Array> auto &&v2) const {
+        Array result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        combine_into(result, std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    constexpr void combine_into(Array &acc, concepts::Same<Array> auto &&v) const {
+        if constexpr (std::is_arithmetic_v<T>) {
+            details::addElementwise(acc.data(), v.data(), N);
+        } else {
+            for (std::size_t i = 0; i < N; ++i) {
+                fl::combine_into(Semigroup<T>(), acc[i], std::forward<decltype(v)>(v)[i]);
+            }
+        }
+    }
+};
+
+/*!
+ * Valarrays are added element-wise. The shorter valarray is padded with zeros, so the empty valarray is the identity.
+ */
+template <class T>
+requires std::is_arithmetic_v<T>
+struct Semigroup<std::valarray<T>> {
+    using Array = std::valarray<T>;
+
+    [[nodiscard]]
+    Array combine(concepts::Same<Array> auto &&v1, concepts::Same<Array> auto &&v2) const {
+        Array result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        combine_into(result, std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    void combine_into(Array &acc, concepts::Same<Array> auto &&v) const {
+        if (v.size() == 0) {
+            return;
+        }
+
+        if (acc.size() >= v.size()) {
+            details::addElementwise(&acc[0], &v[0], v.size());
+        } else {
+            Array result = details::moveOrCopy(std::forward<decltype(v)>(v));
+            if (acc.size() != 0) {
+                details::addElementwise(&result[0], &acc[0], acc.size());
+            }
+            acc = std::move(result);
+        }
+    }
+};
+
+} // namespace fl
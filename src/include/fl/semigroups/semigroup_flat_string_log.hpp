@@ -0,0 +1,62 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/logs/flat_string_log.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class T>
+concept FlatStringLogEntry = std::convertible_to<T, std::string_view>;
+
+} // namespace _concepts
+
+template<>
+struct Semigroup<FlatStringLog> {
+    using Log = FlatStringLog;
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, concepts::Same<Log> auto &&v2) const {
+        Log result;
+        if constexpr (std::is_same_v<decltype(v1), Log &&>) {
+            result = std::move(v1);
+        } else {
+            // Both buffers are allocated once
+            result.reserve(v1.size() + v2.size(), v1.chars_size() + v2.chars_size());
+            result.append(v1);
+        }
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&log, _concepts::FlatStringLogEntry auto &&entry) const {
+        Log result(std::forward<decltype(log)>(log));
+        result.push_back(entry);
+        return result;
+    }
+
+    void combine_into(Log &acc, concepts::Same<Log> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+
+    void combine_into(Log &acc, _concepts::FlatStringLogEntry auto &&entry) const {
+        acc.push_back(entry);
+    }
+};
+
+} // namespace fl
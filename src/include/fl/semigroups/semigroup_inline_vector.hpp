@@ -0,0 +1,33 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup_std_container.hpp>
+#include <fl/logs/inline_vector.hpp>
+
+namespace fl {
+
+// Inline vectors reserve by themselves and steal the heap buffers of rvalues
+template <class T, std::size_t N, class Overflow>
+struct container_traits<InlineVector<T, N, Overflow>> {
+    using Vector = InlineVector<T, N, Overflow>;
+
+    static constexpr void append(Vector &acc, const Vector &v) { acc.append(v); }
+
+    static constexpr void append(Vector &acc, Vector &&v) { acc.append(std::move(v)); }
+
+    template <class V>
+    static constexpr void push_back(Vector &acc, V &&value) {
+        acc.emplace_back(std::forward<V>(value));
+    }
+};
+
+} // namespace fl
@@ -0,0 +1,52 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/logs/merge_map.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class E, class M>
+concept MergeMapEntry = !concepts::Same<E, M> && requires(M m, E &&e) { m.add(std::forward<E>(e)); };
+
+} // namespace _concepts
+
+template<class Key, class T, class Map>
+struct Semigroup<MergeMap<Key, T, Map>> {
+    using Log = MergeMap<Key, T, Map>;
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, concepts::Same<Log> auto &&v2) const {
+        Log result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.merge(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, _concepts::MergeMapEntry<Log> auto &&entry) const {
+        Log result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.add(std::forward<decltype(entry)>(entry));
+        return result;
+    }
+
+    void combine_into(Log &acc, concepts::Same<Log> auto &&v) const {
+        acc.merge(std::forward<decltype(v)>(v));
+    }
+
+    void combine_into(Log &acc, _concepts::MergeMapEntry<Log> auto &&entry) const {
+        acc.add(std::forward<decltype(entry)>(entry));
+    }
+};
+
+} // namespace fl
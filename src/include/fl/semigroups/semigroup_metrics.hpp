@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/semigroups/semigroup_elementwise.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/logs/metrics.hpp>
+#include <fl/logs/histogram.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class E, class M>
+concept MetricEntry = !concepts::Same<E, M> && std::convertible_to<E, typename M::value_type>;
+
+} // namespace _concepts
+
+namespace details {
+
+template <class M, class E>
+constexpr void recordMetric(M &metric, E &&entry) {
+    if constexpr (requires { metric.record(std::forward<E>(entry)); }) {
+        metric.record(std::forward<E>(entry));
+    } else {
+        metric.add(std::forward<E>(entry));
+    }
+}
+
+// Metrics are merged in place, single samples are recorded
+template <class M>
+struct MetricSemigroup {
+    [[nodiscard]]
+    constexpr M combine(concepts::Same<M> auto &&v1, concepts::Same<M> auto &&v2) const {
+        M result = moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.merge(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]]
+    constexpr M combine(concepts::Same<M> auto &&v, _concepts::MetricEntry<M> auto &&entry) const {
+        M result = moveOrCopy(std::forward<decltype(v)>(v));
+        recordMetric(result, std::forward<decltype(entry)>(entry));
+        return result;
+    }
+
+    constexpr void combine_into(M &acc, concepts::Same<M> auto &&v) const {
+        acc.merge(std::forward<decltype(v)>(v));
+    }
+
+    constexpr void combine_into(M &acc, _concepts::MetricEntry<M> auto &&entry) const {
+        recordMetric(acc, std::forward<decltype(entry)>(entry));
+    }
+};
+
+} // namespace details
+
+template <class T>
+struct Semigroup<Counter<T>> : details::MetricSemigroup<Counter<T>> {};
+
+template <class T>
+struct Semigroup<Stats<T>> : details::MetricSemigroup<Stats<T>> {};
+
+template <auto Min, auto Max, std::size_t N, class Count>
+struct Semigroup<Histogram<Min, Max, N, Count>> : details::MetricSemigroup<Histogram<Min, Max, N, Count>> {};
+
+template <std::size_t SubBucketBits, std::size_t MaxBits, class Count>
+struct Semigroup<HdrHistogram<SubBucketBits, MaxBits, Count>>
+    : details::MetricSemigroup<HdrHistogram<SubBucketBits, MaxBits, Count>> {};
+
+} // namespace fl
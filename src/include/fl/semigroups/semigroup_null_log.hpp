@@ -0,0 +1,28 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/logs/null_log.hpp>
+
+namespace fl {
+
+template<>
+struct Semigroup<NullLog> {
+    [[nodiscard]]
+    constexpr NullLog combine(const NullLog &, const concepts::DiscardedEntry auto &) const noexcept {
+        return {};
+    }
+
+    constexpr void combine_into(NullLog &, const concepts::DiscardedEntry auto &) const noexcept {}
+};
+
+} // namespace fl
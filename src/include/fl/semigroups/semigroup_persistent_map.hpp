@@ -0,0 +1,55 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/logs/persistent_map.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class E, class M>
+concept PersistentMapEntry = !concepts::Same<E, M> && requires(M m, E &&e) {
+    m.set(std::forward<E>(e).first, std::forward<E>(e).second);
+};
+
+} // namespace _concepts
+
+// Maps are merged with structural sharing, values of the right map win
+template <class Key, class T, class Hash, class Equal>
+struct Semigroup<PersistentMap<Key, T, Hash, Equal>> {
+    using Log = PersistentMap<Key, T, Hash, Equal>;
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, concepts::Same<Log> auto &&v2) const {
+        Log result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.merge(v2);
+        return result;
+    }
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, _concepts::PersistentMapEntry<Log> auto &&entry) const {
+        Log result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.set(std::forward<decltype(entry)>(entry).first, std::forward<decltype(entry)>(entry).second);
+        return result;
+    }
+
+    void combine_into(Log &acc, concepts::Same<Log> auto &&v) const {
+        acc.merge(v);
+    }
+
+    void combine_into(Log &acc, _concepts::PersistentMapEntry<Log> auto &&entry) const {
+        acc.set(std::forward<decltype(entry)>(entry).first, std::forward<decltype(entry)>(entry).second);
+    }
+};
+
+} // namespace fl
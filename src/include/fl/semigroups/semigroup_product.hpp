@@ -0,0 +1,134 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+
+namespace fl {
+
+/*!
+ * Members of an aggregate that is combined field by field, e.g. a set of log channels:
+ * \code{.cpp}
+ *    struct Channels {
+ *        std::vector<std::string> text;
+ *        std::uint64_t requests;
+ *    };
+ *
+ *    template <>
+ *    struct fl::product_members<Channels> {
+ *        static constexpr auto value = std::tuple{&Channels::text, &Channels::requests};
+ *    };
+ * \endcode
+ */
+template <class T>
+struct product_members {};
+
+/*!
+ * Entry for the field \p I of a product log, e.g. a log of std::tuple or std::pair. Other fields are not touched.
+ */
+template <std::size_t I, class E>
+struct ChannelEntry {
+    E entry;
+};
+
+/*!
+ * Create an entry for the field \p I of a product log:
+ * \code{.cpp}
+ *    using Log = std::tuple<std::vector<std::string>, std::uint64_t>;
+ *    auto w = fl::Writer<Log, int>{}.tell(fl::channel<0>(std::string("request"))).tell(fl::channel<1>(1ull));
+ * \endcode
+ */
+template <std::size_t I, class E>
+[[nodiscard]]
+constexpr ChannelEntry<I, std::remove_cvref_t<E>> channel(E &&entry) {
+    return {std::forward<E>(entry)};
+}
+
+namespace _concepts {
+
+template <class T>
+concept ProductAggregate = requires {
+    std::tuple_size<std::remove_cvref_t<decltype(product_members<T>::value)>>::value;
+};
+
+} // namespace _concepts
+
+namespace details {
+
+template <class T>
+inline constexpr std::size_t product_size = std::tuple_size_v<T>;
+
+template <_concepts::ProductAggregate T>
+inline constexpr std::size_t product_size<T> =
+    std::tuple_size_v<std::remove_cvref_t<decltype(product_members<T>::value)>>;
+
+template <std::size_t I, class P>
+constexpr decltype(auto) productField(P &&p) {
+    if constexpr (_concepts::ProductAggregate<std::remove_cvref_t<P>>) {
+        return (std::forward<P>(p).*std::get<I>(product_members<std::remove_cvref_t<P>>::value));
+    } else {
+        return std::get<I>(std::forward<P>(p));
+    }
+}
+
+template <std::size_t I, class P>
+using product_field_t = std::remove_cvref_t<decltype(productField<I>(std::declval<P &>()))>;
+
+// Fields are combined with their own semigroups, rvalue fields are moved through
+template <class P>
+struct ProductSemigroup {
+    [[nodiscard]]
+    constexpr P combine(concepts::Same<P> auto &&v1, concepts::Same<P> auto &&v2) const {
+        P result = moveOrCopy(std::forward<decltype(v1)>(v1));
+        combine_into(result, std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    template <std::size_t I, class E>
+    [[nodiscard]]
+    constexpr P combine(concepts::Same<P> auto &&v, ChannelEntry<I, E> c) const requires (I < product_size<P>) {
+        P result = moveOrCopy(std::forward<decltype(v)>(v));
+        combine_into(result, std::move(c));
+        return result;
+    }
+
+    constexpr void combine_into(P &acc, concepts::Same<P> auto &&v) const {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (fl::combine_into(Semigroup<product_field_t<I, P>>(),
+                              productField<I>(acc),
+                              productField<I>(std::forward<decltype(v)>(v))), ...);
+        }(std::make_index_sequence<product_size<P>>());
+    }
+
+    template <std::size_t I, class E>
+    constexpr void combine_into(P &acc, ChannelEntry<I, E> c) const requires (I < product_size<P>) {
+        fl::combine_into(Semigroup<product_field_t<I, P>>(), productField<I>(acc), std::move(c).entry);
+    }
+};
+
+} // namespace details
+
+template <class... Ts>
+struct Semigroup<std::tuple<Ts...>> : details::ProductSemigroup<std::tuple<Ts...>> {};
+
+template <class A, class B>
+struct Semigroup<std::pair<A, B>> : details::ProductSemigroup<std::pair<A, B>> {};
+
+template <_concepts::ProductAggregate T>
+struct Semigroup<T> : details::ProductSemigroup<T> {};
+
+} // namespace fl
@@ -0,0 +1,45 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/logs/ring_log.hpp>
+
+namespace fl {
+
+template<class T, std::size_t N>
+struct Semigroup<RingLog<T, N>> {
+    using Log = RingLog<T, N>;
+
+    [[nodiscard]] Log combine(concepts::SameContainer<Log> auto &&v1, concepts::SameContainer<Log> auto &&v2) const {
+        Log result(std::forward<decltype(v1)>(v1));
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]]
+    Log combine(concepts::SameContainer<Log> auto &&v1, concepts::SameElementType<Log> auto &&value) const {
+        Log result(std::forward<decltype(v1)>(v1));
+        result.push_back(std::forward<decltype(value)>(value));
+        return result;
+    }
+
+    void combine_into(Log &acc, concepts::SameContainer<Log> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+
+    void combine_into(Log &acc, concepts::SameElementType<Log> auto &&value) const {
+        acc.push_back(std::forward<decltype(value)>(value));
+    }
+};
+
+} // namespace fl
@@ -0,0 +1,42 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/logs/rope.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class T>
+concept PossibleToAppendToRope = requires(Rope r, T &&value) {
+    { r.append(std::forward<T>(value)) } -> std::same_as<Rope &>;
+};
+
+} // namespace _concepts
+
+template<>
+struct Semigroup<Rope> {
+    [[nodiscard]]
+    Rope combine(concepts::SameOrConstructable<Rope> auto &&v1, _concepts::PossibleToAppendToRope auto &&v2) const {
+        Rope result(std::forward<decltype(v1)>(v1));
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    void combine_into(Rope &acc, _concepts::PossibleToAppendToRope auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+};
+
+} // namespace fl
@@ -0,0 +1,54 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
+#include <fl/logs/run_length_log.hpp>
+
+namespace fl {
+
+namespace _concepts {
+
+template <class E, class Log>
+concept RunLengthLogEntry = !concepts::Same<E, Log> && requires(Log &l, E &&e) { l.add(std::forward<E>(e)); };
+
+} // namespace _concepts
+
+template<class T, class Mode, class Hash, class Equal>
+struct Semigroup<RunLengthLog<T, Mode, Hash, Equal>> {
+    using Log = RunLengthLog<T, Mode, Hash, Equal>;
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&v1, concepts::Same<Log> auto &&v2) const {
+        Log result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    [[nodiscard]] Log combine(concepts::Same<Log> auto &&log, _concepts::RunLengthLogEntry<Log> auto &&entry) const {
+        Log result = details::moveOrCopy(std::forward<decltype(log)>(log));
+        result.add(std::forward<decltype(entry)>(entry));
+        return result;
+    }
+
+    void combine_into(Log &acc, concepts::Same<Log> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+
+    void combine_into(Log &acc, _concepts::RunLengthLogEntry<Log> auto &&entry) const {
+        acc.add(std::forward<decltype(entry)>(entry));
+    }
+};
+
+} // namespace fl
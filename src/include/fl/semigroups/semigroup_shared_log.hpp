@@ -0,0 +1,34 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup.hpp>
+#include <fl/concepts/concepts.hpp>
+#include <fl/logs/shared_log.hpp>
+
+namespace fl {
+
+template<class Log>
+struct Semigroup<SharedLog<Log>> {
+    [[nodiscard]]
+    SharedLog<Log> combine(concepts::SameOrConstructable<SharedLog<Log>> auto &&v1,
+                           _concepts::AppendableToSharedLog<Log> auto &&v2) const {
+        SharedLog<Log> result(std::forward<decltype(v1)>(v1));
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    void combine_into(SharedLog<Log> &acc, _concepts::AppendableToSharedLog<Log> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+};
+
+} // namespace fl
@@ -0,0 +1,30 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <fl/semigroups/semigroup_metrics.hpp>
+#include <fl/logs/hyper_log_log.hpp>
+#include <fl/logs/count_min_sketch.hpp>
+#include <fl/logs/t_digest.hpp>
+
+namespace fl {
+
+template <class T, std::size_t Precision, class Hash>
+struct Semigroup<HyperLogLog<T, Precision, Hash>> : details::MetricSemigroup<HyperLogLog<T, Precision, Hash>> {};
+
+template <class T, std::size_t Width, std::size_t Depth, class Count, class Hash>
+struct Semigroup<CountMinSketch<T, Width, Depth, Count, Hash>>
+    : details::MetricSemigroup<CountMinSketch<T, Width, Depth, Count, Hash>> {};
+
+template <std::size_t Compression>
+struct Semigroup<TDigest<Compression>> : details::MetricSemigroup<TDigest<Compression>> {};
+
+} // namespace fl
@@ -11,10 +11,14 @@
 #pragma once
 
 #include <fl/semigroups/semigroup.hpp>
+#include <fl/semigroups/growth_policy.hpp>
+#include <fl/semigroups/container_traits.hpp>
 #include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 
 namespace fl {
 
@@ -34,8 +38,37 @@ void append(concepts::PushableContainer auto &r, concepts::PushableContainer aut
     }
 }
 
+// Nodes can be spliced only between containers with equal allocators
+bool canMerge(const concepts::InsertableContainer auto &r, const concepts::InsertableContainer auto &c)
+{
+    using Allocator = typename std::remove_cvref_t<decltype(r)>::allocator_type;
+    if constexpr (std::allocator_traits<Allocator>::is_always_equal::value) {
+        return true;
+    } else {
+        return r.get_allocator() == c.get_allocator();
+    }
+}
+
 void append(concepts::InsertableContainer auto &r, concepts::InsertableContainer auto &&c)
 {
+    using C = std::remove_reference_t<decltype(c)>;
+    if constexpr (std::is_rvalue_reference_v<decltype(c)> && !std::is_const_v<C> && requires { r.merge(c); }) {
+        // Nodes are moved without allocations, elements with existing keys are dropped like with insert
+        if (canMerge(r, c)) {
+            if constexpr (requires { typename C::key_compare; }) {
+                // Unlike merge, hinted insertion is amortized O(1) for ordered ranges, and nodes of c come in order
+                auto hint = r.end();
+                while (!c.empty()) {
+                    auto it = r.insert(hint, c.extract(c.begin()));
+                    hint = std::next(it);
+                }
+            } else {
+                r.merge(c);
+            }
+            return;
+        }
+    }
+
     if constexpr (std::is_rvalue_reference_v<decltype(c)>) {
         r.insert(std::make_move_iterator(std::begin(c)), std::make_move_iterator(std::end(c)));
     } else {
@@ -45,23 +78,64 @@ void append(concepts::InsertableContainer auto &r, concepts::InsertableContainer
 
 void reserve(concepts::PushableContainer auto &r, std::size_t size)
 {
-    r.reserve(size);
+    if constexpr (requires { { r.capacity() } -> std::convertible_to<std::size_t>; }) {
+        if (r.capacity() < size) {
+            r.reserve(growth_policy_t<decltype(r)>::capacity(r.capacity(), size));
+        }
+    } else {
+        r.reserve(size);
+    }
 }
 
-void reserve(concepts::InsertableContainer auto &, std::size_t) {}
+// Unordered containers allocate buckets once instead of rehashing while elements are inserted
+void reserve(concepts::InsertableContainer auto &r, std::size_t size)
+{
+    if constexpr (requires { r.reserve(size); r.bucket_count(); r.max_load_factor(); }) {
+        // Reserving less than the current capacity may shrink the buckets
+        if (static_cast<float>(size) > static_cast<float>(r.bucket_count()) * r.max_load_factor()) {
+            r.reserve(size);
+        }
+    }
+}
 
-auto combineImpl(concepts::PushableOrInsertableContainer auto &&f, concepts::PushableOrInsertableContainer auto &&s)
-    requires all_same<decltype(f), decltype(s)>
+// Elements are constructed in place, so they get the allocator of the container
+void pushBack(concepts::PushableContainer auto &r, auto &&value)
+{
+    if constexpr (requires { r.emplace_back(std::forward<decltype(value)>(value)); }) {
+        r.emplace_back(std::forward<decltype(value)>(value));
+    } else {
+        r.push_back(std::forward<decltype(value)>(value));
+    }
+}
+
+void insert(concepts::InsertableContainer auto &r, auto &&value)
+{
+    if constexpr (requires { r.emplace(std::forward<decltype(value)>(value)); }) {
+        r.emplace(std::forward<decltype(value)>(value));
+    } else {
+        r.insert(std::forward<decltype(value)>(value));
+    }
+}
+
+// The total size is reserved once, then all containers are appended
+auto combineImpl(concepts::PushableOrInsertableContainer auto &&f, concepts::PushableOrInsertableContainer auto &&...s)
+    requires all_same<decltype(f), decltype(s)...>
 {
     if constexpr (std::is_rvalue_reference_v<decltype(f)>) {
-        reserve(f, f.size() + s.size());
-        append(f, std::forward<decltype(s)>(s));
+        reserve(f, (f.size() + ... + s.size()));
+        (append(f, std::forward<decltype(s)>(s)), ...);
         return f;
     } else {
-        std::remove_cvref_t<decltype(f)> r;
-        reserve(r, f.size() + s.size());
+        std::remove_cvref_t<decltype(f)> r = [&] {
+            if constexpr (concepts::AllocatorAware<decltype(f)>) {
+                return std::remove_cvref_t<decltype(f)>(f.get_allocator());
+            } else {
+                return std::remove_cvref_t<decltype(f)>();
+            }
+        }();
+        reserve(r, (f.size() + ... + s.size()));
         append(r, std::forward<decltype(f)>(f));
-        append(r, std::forward<decltype(s)>(s));
+        (append(r, std::forward<decltype(s)>(s)), ...);
         return r;
     }
 }
@@ -69,27 +143,119 @@ auto combineImpl(concepts::PushableOrInsertableContainer auto &&f, concepts::Pus
 }
 
 template<concepts::PushableContainer T>
+requires (!concepts::CustomizedContainer<T>)
 struct Semigroup<T> {
-    [[nodiscard]] T combine(concepts::SameContainer<T> auto&& v1, concepts::SameContainer<T> auto&& v2) const {
-        return details::combineImpl(std::forward<decltype(v1)>(v1), std::forward<decltype(v2)>(v2));
+    /*!
+     * Combine two or more containers. The total size is reserved once, so the elements are stored with a single
+     * allocation.
+     */
+    [[nodiscard]]
+    T combine(concepts::SameContainer<T> auto &&v1, concepts::SameContainer<T> auto &&v2,
+              concepts::SameContainer<T> auto &&...vs) const {
+        return details::combineImpl(std::forward<decltype(v1)>(v1), std::forward<decltype(v2)>(v2),
+                                    std::forward<decltype(vs)>(vs)...);
     }
 
-    [[nodiscard]] T combine(concepts::SameContainer<T> auto container, concepts::SameElementType<T> auto &&value) const {
-        container.push_back(std::forward<decltype(value)>(value));
-        return container;
+    [[nodiscard]]
+    T combine(concepts::SameContainer<T> auto &&container, concepts::SameElementType<T> auto &&value) const {
+        T result = details::moveOrCopy(std::forward<decltype(container)>(container));
+        details::pushBack(result, std::forward<decltype(value)>(value));
+        return result;
+    }
+
+    void combine_into(T &acc, concepts::SameContainer<T> auto &&v) const {
+        details::reserve(acc, acc.size() + v.size());
+        details::append(acc, std::forward<decltype(v)>(v));
+    }
+
+    /*!
+     * Reserve memory for \p size elements, e.g. before several logs are combined into \p acc.
+     */
+    void reserve(T &acc, std::size_t size) const { details::reserve(acc, size); }
+
+    void combine_into(T &acc, concepts::SameElementType<T> auto &&value) const {
+        details::pushBack(acc, std::forward<decltype(value)>(value));
     }
 };
 
 template<concepts::InsertableContainer T>
+requires (!concepts::CustomizedContainer<T>)
+struct Semigroup<T> {
+    /*!
+     * Combine two or more containers. Each element gets its own node, but unordered containers allocate buckets once
+     * for the total size, and nodes of rvalue containers are spliced without allocations when possible.
+     */
+    [[nodiscard]]
+    T combine(concepts::SameContainer<T> auto &&v1, concepts::SameContainer<T> auto &&v2,
+              concepts::SameContainer<T> auto &&...vs) const {
+        return details::combineImpl(std::forward<decltype(v1)>(v1), std::forward<decltype(v2)>(v2),
+                                    std::forward<decltype(vs)>(vs)...);
+    }
+
+    [[nodiscard]]
+    T combine(concepts::SameContainer<T> auto &&container, concepts::SameElementType<T> auto &&value) const {
+        T result = details::moveOrCopy(std::forward<decltype(container)>(container));
+        details::insert(result, std::forward<decltype(value)>(value));
+        return result;
+    }
+
+    void combine_into(T &acc, concepts::SameContainer<T> auto &&v) const {
+        details::reserve(acc, acc.size() + v.size());
+        details::append(acc, std::forward<decltype(v)>(v));
+    }
+
+    /*!
+     * Reserve memory for \p size elements, e.g. before several logs are combined into \p acc.
+     */
+    void reserve(T &acc, std::size_t size) const { details::reserve(acc, size); }
+
+    void combine_into(T &acc, concepts::SameElementType<T> auto &&value) const {
+        details::insert(acc, std::forward<decltype(value)>(value));
+    }
+};
+
+/*!
+ * Semigroup for containers with \p container_traits, e.g. std::list and std::deque.
+ */
+template<concepts::CustomizedContainer T>
 struct Semigroup<T> {
-    [[nodiscard]] T combine(concepts::SameContainer<T> auto&& v1, concepts::SameContainer<T> auto&& v2) const {
-        return details::combineImpl(std::forward<decltype(v1)>(v1), std::forward<decltype(v2)>(v2));
+    /*!
+     * Combine two or more containers. If the traits provide \p reserve, the total size is reserved once; rvalue
+     * containers are spliced if the traits provide \p splice.
+     */
+    [[nodiscard]]
+    constexpr T combine(concepts::SameContainer<T> auto &&v1, concepts::SameContainer<T> auto &&v2,
+                        concepts::SameContainer<T> auto &&...vs) const {
+        T result = details::moveOrCopy(std::forward<decltype(v1)>(v1));
+        if constexpr (requires { container_traits<T>::reserve(result, result.size()); }) {
+            container_traits<T>::reserve(result, ((result.size() + v2.size()) + ... + vs.size()));
+        }
+        details::traitsAppend(result, std::forward<decltype(v2)>(v2));
+        (details::traitsAppend(result, std::forward<decltype(vs)>(vs)), ...);
+        return result;
     }
 
     [[nodiscard]]
-    decltype(auto) combine(concepts::SameContainer<T> auto container, concepts::SameElementType<T> auto &&value) const {
-        container.insert(std::forward<decltype(value)>(value));
-        return container;
+    constexpr T combine(concepts::SameContainer<T> auto &&container, concepts::SameElementType<T> auto &&value) const {
+        T result = details::moveOrCopy(std::forward<decltype(container)>(container));
+        container_traits<T>::push_back(result, std::forward<decltype(value)>(value));
+        return result;
+    }
+
+    constexpr void combine_into(T &acc, concepts::SameContainer<T> auto &&v) const {
+        details::traitsAppend(acc, std::forward<decltype(v)>(v));
+    }
+
+    /*!
+     * Reserve memory for \p size elements, available if the traits provide \p reserve.
+     */
+    constexpr void reserve(T &acc, std::size_t size) const
+    requires requires { container_traits<T>::reserve(acc, size); } {
+        container_traits<T>::reserve(acc, size);
+    }
+
+    constexpr void combine_into(T &acc, concepts::SameElementType<T> auto &&value) const {
+        container_traits<T>::push_back(acc, std::forward<decltype(value)>(value));
     }
 };
 } // namespace fl
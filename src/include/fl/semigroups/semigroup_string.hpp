@@ -11,27 +11,91 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <fl/semigroups/semigroup.hpp>
 
 #include <fl/concepts/concepts.hpp>
+#include <fl/utils/allocator.hpp>
 
 namespace fl {
 
 namespace _concepts {
 
-template <class T>
-concept PossibleToAppend = requires(std::string s, T &&value) {
-    { s.append(std::forward<T>(value)) } -> std::same_as<std::add_lvalue_reference_t<std::string>>;
+template <class T, class String = std::string>
+concept PossibleToAppend = requires(String s, T &&value) {
+    { s.append(std::forward<T>(value)) } -> std::same_as<std::add_lvalue_reference_t<String>>;
 };
 
+template <class T, class String = std::string>
+concept StringViewLike =
+    std::convertible_to<T, std::basic_string_view<typename String::value_type, typename String::traits_type>>;
+
 } // namespace concepts
 
-template<>
-struct Semigroup<std::string> {
+/*!
+ * Semigroup for strings. Combined strings use the allocator of the first string.
+ */
+template<class Char, class Traits, class Allocator>
+struct Semigroup<std::basic_string<Char, Traits, Allocator>> {
+    using String = std::basic_string<Char, Traits, Allocator>;
+
+    [[nodiscard]]
+    String combine(concepts::SameOrConstructable<String> auto &&v1, _concepts::PossibleToAppend<String> auto &&v2) const {
+        String result = [&] {
+            if constexpr (concepts::Same<decltype(v1), String>) {
+                return details::moveOrCopy(std::forward<decltype(v1)>(v1));
+            } else {
+                return String(std::forward<decltype(v1)>(v1));
+            }
+        }();
+        result.append(std::forward<decltype(v2)>(v2));
+        return result;
+    }
+
+    /*!
+     * Combine three or more strings with a single allocation.
+     */
     [[nodiscard]]
-    std::string combine(concepts::SameOrConstructable<std::string> auto v1, _concepts::PossibleToAppend auto &&v2) const {
-        return std::string(v1).append(std::forward<decltype(v2)>(v2));
+    String combine(_concepts::StringViewLike<String> auto &&v1, _concepts::StringViewLike<String> auto &&v2,
+                   _concepts::StringViewLike<String> auto &&v3, _concepts::StringViewLike<String> auto &&...vs) const {
+        using View = std::basic_string_view<Char, Traits>;
+        const auto size = ((View(v1).size() + View(v2).size() + View(v3).size()) + ... + View(vs).size());
+
+        // Only the first string is moved, otherwise it would be copied and reallocated
+        constexpr bool moveFirst = concepts::Same<decltype(v1), String> && std::is_rvalue_reference_v<decltype(v1)> &&
+                                   !std::is_const_v<std::remove_reference_t<decltype(v1)>>;
+        String result = [&] {
+            if constexpr (moveFirst) {
+                return String(std::move(v1));
+            } else if constexpr (concepts::Same<decltype(v1), String>) {
+                return String(v1.get_allocator());
+            } else {
+                return String();
+            }
+        }();
+        result.reserve(size);
+        if constexpr (!moveFirst) {
+            result.append(View(v1));
+        }
+        result.append(View(v2));
+        result.append(View(v3));
+        (result.append(View(vs)), ...);
+
+        return result;
+    }
+
+    void combine_into(String &acc, _concepts::PossibleToAppend<String> auto &&v) const {
+        acc.append(std::forward<decltype(v)>(v));
+    }
+
+    /*!
+     * Reserve memory for \p size characters, e.g. before several strings are combined into \p acc.
+     */
+    void reserve(String &acc, std::size_t size) const {
+        if (acc.capacity() < size) {
+            acc.reserve(size);
+        }
     }
 };
 } // namespace fl
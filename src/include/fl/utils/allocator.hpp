@@ -0,0 +1,57 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace fl {
+
+namespace concepts {
+
+/*!
+ * Types that have an allocator and can be copied with the given allocator, e.g. std::pmr::vector.
+ */
+template <class T>
+concept AllocatorAware = requires(const std::remove_cvref_t<T> &v) {
+    v.get_allocator();
+    requires std::constructible_from<std::remove_cvref_t<T>, const std::remove_cvref_t<T> &, decltype(v.get_allocator())>;
+};
+
+} // namespace concepts
+
+namespace details {
+
+// Copy constructors take the allocator from select_on_container_copy_construction, so std::pmr objects end up in the
+// default memory resource. Copies made by semigroups and writers keep the allocator of the source instead.
+template <class T>
+constexpr T copyWithAllocator(const T &v) {
+    if constexpr (concepts::AllocatorAware<T>) {
+        return T(v, v.get_allocator());
+    } else {
+        return v;
+    }
+}
+
+// Move rvalues, copy everything else with the allocator of the source.
+template <class T>
+constexpr std::remove_cvref_t<T> moveOrCopy(T &&v) {
+    if constexpr (std::is_rvalue_reference_v<T &&> && !std::is_const_v<std::remove_reference_t<T>>) {
+        return std::move(v);
+    } else {
+        return copyWithAllocator<std::remove_cvref_t<T>>(v);
+    }
+}
+
+} // namespace details
+
+} // namespace fl
@@ -0,0 +1,21 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+// MSVC accepts [[no_unique_address]], but ignores it to keep ABI compatibility
+#if defined(_MSC_VER)
+#define FL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define FL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// Pointers that don't alias each other, so loops over them are vectorized without runtime overlap checks
+#define FL_RESTRICT __restrict
@@ -0,0 +1,28 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <cstdint>
+
+namespace fl::details {
+
+// Hashes like std::hash<int> are identities, sketches need all bits to be mixed. It's the finalizer of MurmurHash3.
+[[nodiscard]]
+constexpr std::uint64_t mixHash(std::uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+} // namespace fl::details
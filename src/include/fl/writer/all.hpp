@@ -12,4 +12,5 @@
 
 #include <fl/semigroups/all.hpp>
 #include <fl/monoids/all.hpp>
-#include <fl/writer/writer.hpp>
\ No newline at end of file
+#include <fl/writer/writer.hpp>
+#include <fl/writer/tell_at.hpp>
\ No newline at end of file
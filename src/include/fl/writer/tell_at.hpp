@@ -0,0 +1,60 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <fl/concepts/concepts.hpp>
+#include <fl/logs/leveled.hpp>
+#include <fl/writer/writer.hpp>
+
+namespace fl {
+
+/*!
+ * Add a log entry of the level \p L if \p filter passes it.
+ *
+ * The entry is wrapped into \p Leveled, so the log must accept \p Leveled<Entry>. When the entry is filtered out,
+ * \p make_entry is not invoked and the logs are not combined. Levels that the filter removes at compile time cost
+ * nothing at all. For example:
+ * \code{.cpp}
+ *    using Logger = fl::Writer<std::vector<fl::Leveled<std::string>>, int>;
+ *
+ *    fl::filters::Threshold filter{fl::Level::Info};
+ *    auto w = fl::tell_at<fl::Level::Debug>(Logger{{}, 42}, filter, [](int v) { return fmt::format("{}", v); });
+ * \endcode
+ *
+ * @tparam L the level of entry.
+ * @param w a writer.
+ * @param filter a function that accepts \p Level and returns true if entries of this level should be added.
+ * @param make_entry function that accepts the value of writer and returns an entry.
+ * @return a writer with the same value and possibly combined logs.
+ */
+template <Level L, concepts::IsWriter W, class Filter, class F>
+requires std::predicate<Filter &, Level>
+constexpr auto tell_at(W &&w, Filter &&filter, F make_entry) {
+    using WriterType = std::remove_cvref_t<W>;
+
+    if constexpr (!details::compiled_in<std::remove_cvref_t<Filter>, L>) {
+        if constexpr (std::is_rvalue_reference_v<W &&> && !std::is_const_v<std::remove_reference_t<W>>) {
+            return WriterType(std::move(w));
+        } else {
+            return WriterType{details::copyWithAllocator(w.log_), w.value_};
+        }
+    } else {
+        return std::forward<W>(w).tell_if(
+            [&] { return std::invoke(filter, L); },
+            [&](const typename WriterType::ValueType &v) { return Leveled{L, std::invoke(make_entry, v)}; });
+    }
+}
+
+} // namespace fl
@@ -12,11 +12,16 @@
 
 #include <functional>
 #include <concepts>
+#include <ranges>
+#include <utility>
 
 #include "fl/semigroups/semigroup.hpp"
 #include "fl/monoids/monoid.hpp"
 #include "fl/concepts/concepts.hpp"
 #include "fl/semigroups/any_semigroup.hpp"
+#include "fl/logs/null_log.hpp"
+#include "fl/utils/attributes.hpp"
+#include "fl/utils/allocator.hpp"
 
 namespace fl {
 
@@ -45,6 +50,9 @@ concept WithMonoid = requires { Monoid<V>(); };
  *    }
  * \endcode
  *
+ * Logging can be switched off by using \p NullLog as the log type (see the specialization below). Copies of logs keep
+ * their allocators, so logs with std::pmr allocators stay in their memory resource.
+ *
  * @tparam Log the type of log.
  * @tparam Value the type of value.
  */
@@ -61,7 +69,7 @@ struct Writer {
      */
     constexpr auto transform(concepts::Invocable<ValueType> auto f) const & {
         return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<decltype(f), ValueType>>>{
-            log_, std::invoke(f, value_)
+            details::copyWithAllocator(log_), std::invoke(f, value_)
         };
     }
 
@@ -73,7 +81,7 @@ struct Writer {
 
     constexpr auto transform(concepts::Invocable<ValueType> auto f) const && {
         return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<decltype(f), ValueType>>>{
-            std::move(log_), std::invoke(f, std::move(value_))
+            details::copyWithAllocator(log_), std::invoke(f, std::move(value_))
         };
     }
 
@@ -81,7 +89,7 @@ struct Writer {
      * Add a log entry.
      *
      * The class \p Semigroup is used for combining the existing log with the new one. This class must exist for
-     * \p LogType.
+     * \p LogType. Rvalue writers append in place if the semigroup provides \p combine_into.
      *
      * @param l a log entry to add.
      * @return a copy of the object with the same value and combined logs.
@@ -91,8 +99,8 @@ struct Writer {
     }
 
     constexpr auto tell(concepts::ValidTellEntry<LogType> auto &&l) && {
-        return Writer{Semigroup<LogType>{}.combine(std::move(log_), std::forward<decltype(l)>(l)),
-                                     std::move(value_)};
+        return Writer{details::combineMoved(Semigroup<LogType>{}, std::move(log_), std::forward<decltype(l)>(l)),
+                      std::move(value_)};
     }
 
     constexpr auto tell(concepts::ValidTellEntry<LogType> auto &&l) const && {
@@ -105,20 +113,123 @@ struct Writer {
     }
 
     constexpr auto tell(concepts::CombinableWithSgWrapper<LogType> auto &&l, const SemigroupWrapper<LogType> &sg) && {
-        return Writer{sg.combine(std::move(log_), std::forward<decltype(l)>(l)), std::move(value_)};
+        return Writer{details::combineMoved(sg, std::move(log_), std::forward<decltype(l)>(l)), std::move(value_)};
     }
 
     constexpr auto tell(concepts::CombinableWithSgWrapper<LogType> auto &&l, const SemigroupWrapper<LogType> &sg) const && {
         return Writer{sg.combine(std::move(log_), std::forward<decltype(l)>(l)), std::move(value_)};
     }
 
+    /*!
+     * Add all log entries from \p entries in order.
+     *
+     * The same as calling \p tell for each entry, but the log is copied at most once.
+     *
+     * @param entries a range of log entries.
+     * @return a copy of the object with the same value and combined logs.
+     */
+    template <std::ranges::input_range R>
+    requires concepts::ValidTellEntry<std::ranges::range_reference_t<R>, LogType>
+    constexpr auto tell_all(R &&entries) const & {
+        auto log = details::copyWithAllocator(log_);
+        for (auto &&e : entries) {
+            combine_into(Semigroup<LogType>(), log, std::forward<decltype(e)>(e));
+        }
+        return Writer{std::move(log), value_};
+    }
+
+    template <std::ranges::input_range R>
+    requires concepts::ValidTellEntry<std::ranges::range_reference_t<R>, LogType>
+    constexpr auto tell_all(R &&entries) && {
+        for (auto &&e : entries) {
+            combine_into(Semigroup<LogType>(), log_, std::forward<decltype(e)>(e));
+        }
+        return Writer{std::move(log_), std::move(value_)};
+    }
+
+    /*!
+     * Add all log entries from \p entries in order using \p sg.
+     *
+     * The semigroup is invoked once for the whole range (see \p SemigroupWrapper::combine_many) instead of once per
+     * entry. Entries that are not stored contiguously as \p LogType are converted to \p LogType first.
+     *
+     * @param entries a range of log entries.
+     * @param sg the semigroup.
+     * @return a copy of the object with the same value and combined logs.
+     */
+    template <std::ranges::input_range R>
+    requires concepts::SameOrConstructable<std::ranges::range_reference_t<R>, LogType>
+    auto tell_all(R &&entries, const SemigroupWrapper<LogType> &sg) const & {
+        auto log = details::copyWithAllocator(log_);
+        details::combineRange(sg, log, std::forward<R>(entries));
+        return Writer{std::move(log), value_};
+    }
+
+    template <std::ranges::input_range R>
+    requires concepts::SameOrConstructable<std::ranges::range_reference_t<R>, LogType>
+    auto tell_all(R &&entries, const SemigroupWrapper<LogType> &sg) && {
+        details::combineRange(sg, log_, std::forward<R>(entries));
+        return Writer{std::move(log_), std::move(value_)};
+    }
+
+    /*!
+     * Add a log entry created by \p make_entry.
+     *
+     * The function is not invoked if the log discards entries (see \p discards_entries), e.g. for \p NullLog, so
+     * arguments of expensive entries are not evaluated when logging is switched off.
+     *
+     * @param make_entry function that accepts the value and returns a log entry.
+     * @return a copy of the object with the same value and combined logs.
+     */
+    constexpr auto tell_with(concepts::Invocable<const ValueType &> auto make_entry) const & {
+        return tell(std::invoke(make_entry, std::as_const(value_)));
+    }
+
+    constexpr auto tell_with(concepts::Invocable<const ValueType &> auto make_entry) && {
+        return std::move(*this).tell(std::invoke(make_entry, std::as_const(value_)));
+    }
+
+    constexpr auto tell_with(concepts::Invocable<const ValueType &> auto make_entry) const && {
+        return std::move(*this).tell(std::invoke(make_entry, std::as_const(value_)));
+    }
+
+    /*!
+     * Add a log entry created by \p make_entry if \p pred returns true.
+     *
+     * Otherwise neither the entry is created nor the logs are combined, so disabled entries are cheap on hot paths.
+     *
+     * @param pred function without arguments that returns true if the entry should be added.
+     * @param make_entry function that accepts the value and returns a log entry.
+     * @return a copy of the object with the same value and possibly combined logs.
+     */
+    constexpr auto tell_if(std::predicate auto pred, concepts::Invocable<const ValueType &> auto make_entry) const & {
+        if (std::invoke(pred)) {
+            return tell_with(std::move(make_entry));
+        }
+        return Writer{details::copyWithAllocator(log_), value_};
+    }
+
+    constexpr auto tell_if(std::predicate auto pred, concepts::Invocable<const ValueType &> auto make_entry) && {
+        if (std::invoke(pred)) {
+            return std::move(*this).tell_with(std::move(make_entry));
+        }
+        return Writer(std::move(*this));
+    }
+
+    constexpr auto tell_if(std::predicate auto pred, concepts::Invocable<const ValueType &> auto make_entry) const && {
+        if (std::invoke(pred)) {
+            return std::move(*this).tell_with(std::move(make_entry));
+        }
+        return Writer{details::copyWithAllocator(log_), std::move(value_)};
+    }
+
     /*!
      * Change places of value and log.
      *
      * @return a new writer object of the type Writer<Value, Log>.
      */
     constexpr auto swap() const & {
-        return Writer<ValueType, LogType>{value_, log_};
+        return Writer<ValueType, LogType>{value_, details::copyWithAllocator(log_)};
     }
 
     constexpr auto swap() && {
@@ -126,7 +237,7 @@ struct Writer {
     }
 
     constexpr auto swap() const && {
-        return Writer<ValueType, LogType>{std::move(value_), std::move(log_)};
+        return Writer<ValueType, LogType>{std::move(value_), details::copyWithAllocator(log_)};
     }
 
     /*!
@@ -150,7 +261,7 @@ struct Writer {
      * @return a copy of the log object.
      */
     constexpr auto log() const & {
-        return log_;
+        return details::copyWithAllocator(log_);
     }
 
     constexpr auto log() && {
@@ -158,7 +269,7 @@ struct Writer {
     }
 
     constexpr auto log() const && {
-        return std::move(log_);
+        return details::copyWithAllocator(log_);
     }
 
     /*!
@@ -166,7 +277,7 @@ struct Writer {
      * @return a tuple of copies of log and value objects.
      */
     constexpr auto as_tuple() const & {
-        return std::make_tuple(log_, value_);
+        return std::make_tuple(details::copyWithAllocator(log_), value_);
     }
 
     constexpr auto as_tuple() && {
@@ -174,19 +285,23 @@ struct Writer {
     }
 
     constexpr auto as_tuple() const && {
-        return std::make_tuple(std::move(log_), std::move(value_));
+        return std::make_tuple(details::copyWithAllocator(log_), std::move(value_));
     }
 
     /*!
      * Drop existing logs.
      *
-     * The class \p Monoid must exist for the \p LogType.
+     * The class \p Monoid must exist for the \p LogType. The new log gets the allocator of the existing one.
      *
      * @return a new object with empty log and the same value.
      */
     constexpr auto reset() const
     requires _concepts::WithMonoid<LogType> {
-        return Writer{Monoid<LogType>().identity(), value_};
+        if constexpr (requires { Monoid<LogType>().identity(log_.get_allocator()); }) {
+            return Writer{Monoid<LogType>().identity(log_.get_allocator()), value_};
+        } else {
+            return Writer{Monoid<LogType>().identity(), value_};
+        }
     }
 
     /*!
@@ -207,7 +322,7 @@ struct Writer {
     requires concepts::WithSemigroup<LogType> {
         auto &&w = std::invoke(f, std::move(value_));
         return std::remove_cvref_t<decltype(w)>{
-            Semigroup<LogType>().combine(std::move(log_), std::move(w.log_)),
+            details::combineMoved(Semigroup<LogType>(), std::move(log_), std::move(w.log_)),
             std::move(w.value_)
         };
     }
@@ -261,4 +376,138 @@ struct Writer {
     ValueType value_;
 };
 
+/*!
+ * Writer with disabled logging.
+ *
+ * Used for logs that discard all entries, e.g. \p NullLog. The log is never combined, so \p tell and \p and_then cost
+ * nothing, entries passed to \p tell_with and \p tell_if are not created, and the writer has the same size as
+ * \p Value. The interface is the same as for other writers, so the code doesn't change when logging is switched off.
+ *
+ * @tparam Log the type of log that discards entries.
+ * @tparam Value the type of value.
+ */
+template<class Log, class Value>
+requires discards_entries_v<Log>
+struct Writer<Log, Value> {
+    using LogType = std::remove_cvref_t<Log>;
+    using ValueType = std::remove_cvref_t<Value>;
+
+    constexpr auto transform(concepts::Invocable<ValueType> auto f) const & {
+        return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<decltype(f), ValueType>>>{
+            log_, std::invoke(f, value_)
+        };
+    }
+
+    constexpr auto transform(concepts::Invocable<ValueType> auto f) && {
+        return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<decltype(f), ValueType>>>{
+            log_, std::invoke(f, std::move(value_))
+        };
+    }
+
+    constexpr auto tell(concepts::DiscardedEntry auto &&) const & { return *this; }
+
+    constexpr auto tell(concepts::DiscardedEntry auto &&) && { return std::move(*this); }
+
+    constexpr auto tell(concepts::DiscardedEntry auto &&, const SemigroupWrapper<LogType> &) const & { return *this; }
+
+    constexpr auto tell(concepts::DiscardedEntry auto &&, const SemigroupWrapper<LogType> &) && {
+        return std::move(*this);
+    }
+
+    template <std::ranges::input_range R>
+    requires concepts::DiscardedEntry<std::ranges::range_reference_t<R>>
+    constexpr auto tell_all(R &&) const & { return *this; }
+
+    template <std::ranges::input_range R>
+    requires concepts::DiscardedEntry<std::ranges::range_reference_t<R>>
+    constexpr auto tell_all(R &&) && { return std::move(*this); }
+
+    template <std::ranges::input_range R>
+    requires concepts::DiscardedEntry<std::ranges::range_reference_t<R>>
+    constexpr auto tell_all(R &&, const SemigroupWrapper<LogType> &) const & { return *this; }
+
+    template <std::ranges::input_range R>
+    requires concepts::DiscardedEntry<std::ranges::range_reference_t<R>>
+    constexpr auto tell_all(R &&, const SemigroupWrapper<LogType> &) && { return std::move(*this); }
+
+    constexpr auto tell_with(concepts::Invocable<const ValueType &> auto) const & { return *this; }
+
+    constexpr auto tell_with(concepts::Invocable<const ValueType &> auto) && { return std::move(*this); }
+
+    constexpr auto tell_if(std::predicate auto, concepts::Invocable<const ValueType &> auto) const & { return *this; }
+
+    constexpr auto tell_if(std::predicate auto, concepts::Invocable<const ValueType &> auto) && {
+        return std::move(*this);
+    }
+
+    constexpr auto swap() const & {
+        return Writer<ValueType, LogType>{value_, log_};
+    }
+
+    constexpr auto swap() && {
+        return Writer<ValueType, LogType>{std::move(value_), log_};
+    }
+
+    constexpr auto value() const & {
+        return value_;
+    }
+
+    constexpr auto value() && {
+        return std::move(value_);
+    }
+
+    constexpr auto log() const {
+        return log_;
+    }
+
+    constexpr auto as_tuple() const & {
+        return std::make_tuple(log_, value_);
+    }
+
+    constexpr auto as_tuple() && {
+        return std::make_tuple(log_, std::move(value_));
+    }
+
+    constexpr auto reset() const {
+        return *this;
+    }
+
+    // Only the value of the writer returned by f is kept, so the result doesn't log either
+    constexpr auto and_then(concepts::InvocableAndReturnsWriter<ValueType> auto f) const & {
+        return AndThenResult<decltype(f)>{log_, std::invoke(f, value_).value()};
+    }
+
+    constexpr auto and_then(concepts::InvocableAndReturnsWriter<ValueType> auto f) && {
+        return AndThenResult<decltype(f)>{log_, std::invoke(f, std::move(value_)).value()};
+    }
+
+    constexpr auto and_then(concepts::InvocableAndReturnsWriter<ValueType> auto f) const && {
+        return AndThenResult<decltype(f)>{log_, std::invoke(f, std::move(value_)).value()};
+    }
+
+    template <concepts::WriterWithApplicative<Writer<LogType, ValueType>> AppWriter>
+    constexpr auto apply(AppWriter &&w) const & {
+        return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<typename std::remove_cvref_t<AppWriter>::ValueType, ValueType>>>{
+            log_, std::invoke(std::forward<AppWriter>(w).value(), value_)
+        };
+    }
+
+    template <concepts::WriterWithApplicative<Writer<LogType, ValueType>> AppWriter>
+    constexpr auto apply(AppWriter &&w) && {
+        return Writer<LogType, std::remove_cvref_t<std::invoke_result_t<typename std::remove_cvref_t<AppWriter>::ValueType, ValueType>>>{
+            log_, std::invoke(std::forward<AppWriter>(w).value(), std::move(value_))
+        };
+    }
+
+    auto operator<=> (const Writer&) const = default;
+    bool operator== (const Writer&) const = default;
+
+    FL_NO_UNIQUE_ADDRESS LogType log_;
+    ValueType value_;
+
+private:
+    template <class F>
+    using AndThenResult = Writer<LogType, typename std::remove_cvref_t<std::invoke_result_t<F, ValueType>>::ValueType>;
+};
+
 } // namespace fl
@@ -0,0 +1,137 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <unordered_set>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+inline std::size_t allocations = 0;
+
+// Counts allocations of all copies
+template <class T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <class U>
+    CountingAllocator(const CountingAllocator<U> &) noexcept {} // NOLINT
+
+    T *allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept { std::allocator<T>().deallocate(p, n); }
+
+    friend bool operator==(const CountingAllocator &, const CountingAllocator &) = default;
+};
+
+using Set = std::set<int, std::less<>, CountingAllocator<int>>;
+using Map = std::map<int, int, std::less<>, CountingAllocator<std::pair<const int, int>>>;
+using UnorderedSet = std::unordered_set<int, std::hash<int>, std::equal_to<>, CountingAllocator<int>>;
+
+template <class C>
+C make(int from, int to) {
+    C c;
+    for (int i = from; i < to; ++i) {
+        if constexpr (requires { typename C::mapped_type; }) {
+            c.emplace(i, i);
+        } else {
+            c.emplace(i);
+        }
+    }
+    return c;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Rvalue associative containers are merged without allocations", "", Set, Map) {
+    fl::Semigroup<TestType> sg;
+    auto c1 = make<TestType>(0, 1000);
+    auto c2 = make<TestType>(500, 1500);
+
+    allocations = 0;
+    const auto r = sg.combine(std::move(c1), std::move(c2));
+
+    REQUIRE(allocations == 0);
+    REQUIRE(r == make<TestType>(0, 1500));
+}
+
+TEST_CASE("Merge associative containers") {
+    SECTION("Unordered set allocates buckets only") {
+        fl::Semigroup<UnorderedSet> sg;
+        auto c1 = make<UnorderedSet>(0, 1000);
+        auto c2 = make<UnorderedSet>(1000, 2000);
+
+        allocations = 0;
+        const auto r = sg.combine(std::move(c1), std::move(c2));
+
+        REQUIRE(allocations <= 1);
+        REQUIRE(r == make<UnorderedSet>(0, 2000));
+    }
+
+    SECTION("Existing keys are kept") {
+        fl::Semigroup<std::map<int, std::string>> sg;
+
+        using Map = std::map<int, std::string>;
+        const auto r = sg.combine(Map{{1, "foo"}}, Map{{1, "bar"}, {2, "baz"}});
+
+        REQUIRE(r == Map{{1, "foo"}, {2, "baz"}});
+    }
+
+    SECTION("Multiset") {
+        fl::Semigroup<std::multiset<int>> sg;
+
+        REQUIRE(sg.combine(std::multiset<int>{1, 2}, std::multiset<int>{1, 3}) == std::multiset<int>{1, 1, 2, 3});
+    }
+
+    SECTION("Different memory resources") {
+        std::pmr::monotonic_buffer_resource r1;
+        std::pmr::monotonic_buffer_resource r2;
+        fl::Semigroup<std::pmr::set<int>> sg;
+
+        auto r = sg.combine(std::pmr::set<int>({1, 2}, &r1), std::pmr::set<int>({3}, &r2));
+
+        REQUIRE(r == std::pmr::set<int>({1, 2, 3}));
+        REQUIRE(r.get_allocator().resource() == &r1);
+    }
+
+    SECTION("Lvalues are not changed") {
+        fl::Semigroup<std::set<int>> sg;
+        std::set<int> s1{1};
+        std::set<int> s2{2};
+
+        fl::combine_into(sg, s1, s2);
+        const auto r = sg.combine(s1, std::set<int>{3});
+
+        REQUIRE(s2 == std::set<int>{2});
+        REQUIRE(s1 == std::set<int>{1, 2});
+        REQUIRE(r == std::set<int>{1, 2, 3});
+    }
+
+    SECTION("Writer") {
+        using Logger = fl::Writer<Set, int>;
+
+        auto w = Logger{make<Set>(0, 100), 1};
+        allocations = 0;
+        w = std::move(w).and_then([](int v) { return Logger{make<Set>(100, 200), v + 1}; });
+
+        REQUIRE(allocations == 100);
+        REQUIRE(w.log_ == make<Set>(0, 200));
+    }
+}
@@ -0,0 +1,201 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Ring = fl::RingLog<int, 3>;
+using Budget = fl::BudgetLog<3 * (sizeof(std::string) + 3)>;
+
+template <class Log>
+std::vector<typename Log::value_type> entries(const Log &l) { return {l.begin(), l.end()}; }
+
+// Replaces all entries with their sum
+struct Sum {
+    void operator()(std::vector<int> &log) const { log = {std::accumulate(log.begin(), log.end(), 0)}; }
+};
+
+using Summing = fl::CompactingLog<std::vector<int>, Sum, 3>;
+
+template <class L, class V>
+concept Appendable = requires(L l, V v) { l.append(std::move(v)); };
+
+template <class L, class V>
+concept Combinable = requires(fl::Semigroup<L> s, L l, V v) {
+    s.combine(l, v);
+    s.combine_into(l, std::move(v));
+};
+
+} // namespace
+
+TEST_CASE("Ring log") {
+    SECTION("The last entries are kept") {
+        Ring l{1, 2, 3, 4};
+        l.push_back(5);
+
+        REQUIRE(entries(l) == std::vector{3, 4, 5});
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.dropped() == 2);
+        REQUIRE(l.front() == 3);
+        REQUIRE(l.back() == 5);
+    }
+
+    SECTION("Append") {
+        Ring l{1, 2};
+        l.append(Ring{3, 4});
+
+        REQUIRE(entries(l) == std::vector{2, 3, 4});
+        REQUIRE(l.dropped() == 1);
+    }
+
+    SECTION("Append full logs") {
+        Ring l{1, 2, 3};
+        const Ring full{4, 5, 6, 7};
+
+        l.append(full);
+        REQUIRE(entries(l) == std::vector{5, 6, 7});
+        REQUIRE(l.dropped() == 4);
+
+        l.append(Ring{8, 9, 10});
+        REQUIRE(entries(l) == std::vector{8, 9, 10});
+        REQUIRE(l.size() == 3);
+    }
+
+    SECTION("Semigroup") {
+        fl::Semigroup<Ring> sg;
+
+        REQUIRE(entries(sg.combine(Ring{1, 2, 3}, Ring{4, 5, 6})) == std::vector{4, 5, 6});
+        REQUIRE(entries(sg.combine(Ring{1, 2, 3}, 4)) == std::vector{2, 3, 4});
+        REQUIRE(sg.combine(Ring{1}, sg.combine(Ring{2, 3}, Ring{4})) ==
+                sg.combine(sg.combine(Ring{1}, Ring{2, 3}), Ring{4}));
+    }
+}
+
+TEST_CASE("Budget log") {
+    SECTION("The oldest entries are dropped") {
+        Budget l{"foo", "bar", "baz"};
+        l.push_back("qux");
+
+        REQUIRE(entries(l) == std::vector<std::string>{"bar", "baz", "qux"});
+        REQUIRE(l.bytes() <= Budget::budget);
+        REQUIRE(l.dropped() == 1);
+    }
+
+    SECTION("Big entries take more room") {
+        Budget l{"foo", "bar", "baz"};
+        l.push_back(std::string(Budget::budget - sizeof(std::string), 'x'));
+
+        REQUIRE(l.size() == 1);
+        REQUIRE(l.dropped() == 3);
+    }
+
+    SECTION("Entries that don't fit are dropped") {
+        Budget l{"foo"};
+        l.push_back(std::string(Budget::budget, 'x'));
+
+        REQUIRE(entries(l) == std::vector<std::string>{"foo"});
+        REQUIRE(l.dropped() == 1);
+    }
+
+    SECTION("Append full logs") {
+        Budget l{"foo", "bar", "baz"};
+        const Budget other{"a", "b", "c", "d", "e"};
+
+        l.append(other);
+
+        REQUIRE(l.bytes() <= Budget::budget);
+        REQUIRE(entries(l).back() == "e");
+        REQUIRE(l.dropped() == 3 + other.dropped() + (other.size() - l.size()));
+    }
+
+    SECTION("Semigroup") {
+        fl::Semigroup<Budget> sg;
+
+        REQUIRE(entries(sg.combine(Budget{"foo", "bar"}, Budget{"baz", "qux"})) ==
+                std::vector<std::string>{"bar", "baz", "qux"});
+        REQUIRE(entries(sg.combine(Budget{"foo"}, std::string("bar"))) == std::vector<std::string>{"foo", "bar"});
+    }
+}
+
+TEST_CASE("Compacting log") {
+    SECTION("Compactor is invoked at the threshold") {
+        Summing l{1, 2, 3};
+        REQUIRE(l.compactions() == 0);
+
+        l.append(4);
+        REQUIRE(l.log() == std::vector{10});
+        REQUIRE(l.compactions() == 1);
+    }
+
+    SECTION("Semigroup") {
+        fl::Semigroup<Summing> sg;
+
+        const auto result = sg.combine(Summing{1, 2, 3}, Summing{4, 5, 6});
+
+        REQUIRE(result.log() == std::vector{21});
+        REQUIRE(result.size() <= Summing::threshold);
+        REQUIRE(sg.combine(Summing{1}, std::vector{2, 3}).log() == std::vector{1, 2, 3});
+        REQUIRE(sg.combine(Summing{1, 2, 3}, 4).log() == std::vector{10});
+    }
+
+    SECTION("Only valid entries can be appended") {
+        STATIC_REQUIRE(Appendable<Summing, int>);
+        STATIC_REQUIRE(Appendable<Summing, std::vector<int>>);
+        STATIC_REQUIRE(Combinable<Summing, int>);
+        STATIC_REQUIRE(!Appendable<Summing, std::string>);
+        STATIC_REQUIRE(!Combinable<Summing, std::string>);
+    }
+}
+
+TEST_CASE("Writer with bounded logs") {
+    SECTION("Ring") {
+        using Logger = fl::Writer<Ring, int>;
+
+        Logger w{{}, 0};
+        for (int i = 0; i < 100; ++i) {
+            w = std::move(w).and_then([](int v) { return Logger{{v}, v + 1}; });
+        }
+
+        REQUIRE(w.value() == 100);
+        REQUIRE(entries(w.log()) == std::vector{97, 98, 99});
+    }
+
+    SECTION("Budget") {
+        using Logger = fl::Writer<Budget, int>;
+
+        Logger w{{}, 0};
+        for (int i = 0; i < 100; ++i) {
+            w = std::move(w).tell(std::to_string(i));
+        }
+
+        REQUIRE(w.log().bytes() <= Budget::budget);
+        REQUIRE(entries(w.log()).back() == "99");
+    }
+
+    SECTION("Compacting") {
+        using Logger = fl::Writer<Summing, int>;
+
+        Logger w{{}, 0};
+        for (int i = 1; i <= 100; ++i) {
+            w = std::move(w).tell(i);
+        }
+
+        const auto log = w.log();
+        REQUIRE(log.size() <= Summing::threshold);
+        REQUIRE(std::accumulate(log.begin(), log.end(), 0) == 5050);
+    }
+}
@@ -0,0 +1,140 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <fl/semigroups/semigroup_chunked_log.hpp>
+#include <fl/monoids/all.hpp>
+#include <fl/writer/writer.hpp>
+
+#include <string>
+#include <vector>
+
+using Chunked = fl::ChunkedLog<std::string, 4>;
+using Entries = std::vector<std::string>;
+
+namespace {
+
+Entries entries(const Chunked &l) { return {l.begin(), l.end()}; }
+
+} // namespace
+
+TEST_CASE("Chunked log") {
+    SECTION("Push back") {
+        Chunked l;
+        for (int i = 0; i < 10; ++i) {
+            l.push_back(std::to_string(i));
+        }
+
+        REQUIRE(l.size() == 10);
+        REQUIRE(l.chunks().size() == 3);
+        REQUIRE(entries(l) == Entries{"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"});
+    }
+
+    SECTION("Chunks are bounded") {
+        Chunked l;
+        for (int i = 0; i < 100; ++i) {
+            l.emplace_back(std::to_string(i));
+        }
+
+        for (const auto &c : l.chunks()) {
+            REQUIRE(c.size() <= Chunked::chunk_size);
+        }
+    }
+
+    SECTION("Rvalue append splices chunks") {
+        Chunked l1{"1", "2", "3", "4"};
+        Chunked l2{"5", "6", "7", "8", "9"};
+        const auto *data = l2.chunks().front().data();
+
+        l1.append(std::move(l2));
+
+        REQUIRE(l2.empty());
+        REQUIRE(l1.size() == 9);
+        REQUIRE(std::next(l1.chunks().begin())->data() == data);
+        REQUIRE(entries(l1) == Entries{"1", "2", "3", "4", "5", "6", "7", "8", "9"});
+    }
+
+    SECTION("Small chunks are merged") {
+        Chunked l{"1"};
+        l.append(Chunked{"2"});
+        l.append(Chunked{"3", "4"});
+
+        REQUIRE(l.chunks().size() == 1);
+        REQUIRE(entries(l) == Entries{"1", "2", "3", "4"});
+    }
+
+    SECTION("Lvalue append copies") {
+        const Chunked l2{"3", "4"};
+        Chunked l1{"1", "2"};
+
+        l1.append(l2);
+
+        REQUIRE(entries(l1) == Entries{"1", "2", "3", "4"});
+        REQUIRE(entries(l2) == Entries{"3", "4"});
+    }
+
+    SECTION("Append to itself") {
+        Chunked l1{"1", "2", "3"};
+        l1.append(l1);
+        REQUIRE(entries(l1) == Entries{"1", "2", "3", "1", "2", "3"});
+
+        Chunked l2{"1", "2", "3"};
+        l2.append(std::move(l2));
+        REQUIRE(l2.size() == 6);
+        REQUIRE(entries(l2) == Entries{"1", "2", "3", "1", "2", "3"});
+    }
+
+    SECTION("Equality") {
+        Chunked l1{"1", "2", "3"};
+        Chunked l2{"1"};
+        l2.append(Chunked{"2", "3"});
+
+        REQUIRE(l1 == l2);
+        REQUIRE(l1 != Chunked{"1", "2"});
+    }
+}
+
+TEST_CASE("Chunked log semigroup") {
+    fl::Semigroup<Chunked> sg;
+
+    SECTION("Combine logs") {
+        REQUIRE(sg.combine(Chunked{"1", "2"}, Chunked{"3"}) == Chunked{"1", "2", "3"});
+
+        const Chunked l1{"1"};
+        const Chunked l2{"2"};
+        REQUIRE(sg.combine(l1, l2) == Chunked{"1", "2"});
+        REQUIRE(sg.combine(l1, Chunked{"2"}) == Chunked{"1", "2"});
+        REQUIRE(sg.combine(Chunked{"1"}, l2) == Chunked{"1", "2"});
+    }
+
+    SECTION("Combine with element") {
+        REQUIRE(sg.combine(Chunked{"1"}, "2") == Chunked{"1", "2"});
+        REQUIRE(sg.combine(Chunked{"1"}, std::string("2")) == Chunked{"1", "2"});
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<Chunked> m;
+
+        REQUIRE(m.combine(m.identity(), Chunked{"1"}) == Chunked{"1"});
+        REQUIRE(m.combine(Chunked{"1"}, m.identity()) == Chunked{"1"});
+    }
+}
+
+TEST_CASE("Writer with chunked log") {
+    using ChunkedLogger = fl::Writer<Chunked, int>;
+
+    const auto w = ChunkedLogger{{"1"}, 1}
+        .tell("2")
+        .and_then([](int v) { return ChunkedLogger{{"3", "4", "5"}, v + 1}; });
+
+    REQUIRE(entries(w.log()) == Entries{"1", "2", "3", "4", "5"});
+    REQUIRE(w.value() == 2);
+}
@@ -0,0 +1,141 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <set>
+
+#include <fl/writer/all.hpp>
+#include <fl/writer/lazy_operations.hpp>
+
+#include "writer_default_types.hpp"
+
+namespace test_combine_into {
+
+struct Concatenation {
+    std::string value;
+
+    bool operator==(const Concatenation &) const = default;
+};
+
+} // namespace test_combine_into
+
+namespace fl {
+
+template<>
+struct Semigroup<test_combine_into::Concatenation> {
+    [[nodiscard]]
+    test_combine_into::Concatenation combine(test_combine_into::Concatenation v1,
+                                             const test_combine_into::Concatenation &v2) const {
+        v1.value.append(v2.value);
+        return v1;
+    }
+};
+
+} // namespace fl
+
+TEST_CASE("Combine into") {
+    SECTION("Vector") {
+        Log l{"foo"};
+        fl::combine_into(fl::Semigroup<Log>(), l, Log{"bar"});
+        fl::combine_into(fl::Semigroup<Log>(), l, "baz");
+
+        REQUIRE(l == Log{"foo", "bar", "baz"});
+    }
+
+    SECTION("Set") {
+        std::set<int> s{1};
+        fl::combine_into(fl::Semigroup<std::set<int>>(), s, std::set<int>{2, 3});
+        fl::combine_into(fl::Semigroup<std::set<int>>(), s, 4);
+
+        REQUIRE(s == std::set<int>{1, 2, 3, 4});
+    }
+
+    SECTION("String") {
+        std::string s = "foo";
+        fl::combine_into(fl::Semigroup<std::string>(), s, "bar");
+
+        REQUIRE(s == "foobar");
+    }
+
+    SECTION("Fallback to combine") {
+        using test_combine_into::Concatenation;
+        static_assert(!fl::concepts::CombinableInto<fl::Semigroup<Concatenation>, Concatenation, Concatenation>);
+
+        Concatenation c{"foo"};
+        fl::combine_into(fl::Semigroup<Concatenation>(), c, Concatenation{"bar"});
+
+        REQUIRE(c == Concatenation{"foobar"});
+
+        int i = 1;
+        fl::combine_into(fl::Semigroup<int>(), i, 2);
+
+        REQUIRE(i == 3);
+    }
+
+    SECTION("Semigroups with in place combine") {
+        static_assert(fl::concepts::CombinableInto<fl::Semigroup<Log>, Log, Log>);
+        static_assert(fl::concepts::CombinableInto<fl::Semigroup<Log>, Log, const char *>);
+        static_assert(fl::concepts::CombinableInto<fl::Semigroup<std::string>, std::string, std::string_view>);
+        static_assert(!fl::concepts::CombinableInto<fl::Semigroup<Log>, const Log, Log>);
+    }
+}
+
+TEST_CASE("Rvalue writers combine logs in place") {
+    const auto reserved = [] {
+        Log l;
+        l.reserve(16);
+        return l;
+    };
+
+    SECTION("Tell") {
+        auto w = Logger{reserved(), 1};
+        const auto *data = w.log_.data();
+
+        const auto r = std::move(w).tell("foo").tell(Log{"bar"});
+
+        REQUIRE(r.log_.data() == data);
+        REQUIRE(r.log() == Log{"foo", "bar"});
+    }
+
+    SECTION("And then") {
+        auto w = Logger{reserved(), 1};
+        const auto *data = w.log_.data();
+
+        const auto r = std::move(w).and_then([](auto v) { return Logger{{"foo"}, v + 1}; });
+
+        REQUIRE(r.log_.data() == data);
+        REQUIRE(r.log() == Log{"foo"});
+        REQUIRE(r.value() == 2);
+    }
+
+    SECTION("Lazy operations") {
+        using namespace fl;
+
+        auto w = Logger{reserved(), 1};
+        const auto *data = w.log_.data();
+
+        const auto r = std::move(w)
+            | tell(Log{"foo"})
+            | and_then([](auto v) { return Logger{{"bar"}, v + 1}; })
+            | tell(std::string("baz"))
+            | eval;
+
+        REQUIRE(r.log_.data() == data);
+        REQUIRE(r.log() == Log{"foo", "bar", "baz"});
+    }
+
+    SECTION("Const writers are not changed") {
+        const auto w = Logger{{"foo"}, 1};
+
+        REQUIRE(std::move(w).tell("bar").log() == Log{"foo", "bar"});
+        REQUIRE(w.log() == Log{"foo"});
+    }
+}
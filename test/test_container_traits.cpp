@@ -0,0 +1,179 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+namespace test_container_traits {
+
+// Doesn't meet the requirements of the standard container semigroups: no reserve, push_back and comparison
+class FlatLog {
+public:
+    using value_type = std::string;
+
+    void add(std::string s) { entries_.push_back(std::move(s)); }
+    void add_all(const FlatLog &other) { entries_.insert(entries_.end(), other.entries_.begin(), other.entries_.end()); }
+
+    [[nodiscard]] const std::vector<std::string> &entries() const { return entries_; }
+
+private:
+    std::vector<std::string> entries_;
+};
+
+// Appends are counted to check that customization overrides the default semigroup
+struct CountingLog : std::vector<int> {
+    using std::vector<int>::vector;
+
+    static inline std::size_t appends = 0;
+};
+
+} // namespace test_container_traits
+
+template <>
+struct fl::container_traits<test_container_traits::FlatLog> {
+    using Log = test_container_traits::FlatLog;
+
+    static void append(Log &acc, const Log &log) { acc.add_all(log); }
+    static void push_back(Log &acc, auto &&value) { acc.add(std::forward<decltype(value)>(value)); }
+};
+
+template <>
+struct fl::container_traits<test_container_traits::CountingLog>
+    : fl::sequence_container_traits<test_container_traits::CountingLog> {
+    using Log = test_container_traits::CountingLog;
+
+    static void append(Log &acc, const Log &log) {
+        ++Log::appends;
+        sequence_container_traits::append(acc, log);
+    }
+};
+
+TEST_CASE("Container traits") {
+    using namespace test_container_traits;
+
+    SECTION("Customized containers") {
+        static_assert(fl::concepts::CustomizedContainer<std::deque<int>>);
+        static_assert(fl::concepts::CustomizedContainer<const std::list<std::string> &>);
+        static_assert(fl::concepts::CustomizedContainer<FlatLog>);
+        static_assert(!fl::concepts::CustomizedContainer<std::vector<int>>);
+    }
+
+    SECTION("Deque") {
+        fl::Semigroup<std::deque<int>> sg;
+        const std::deque<int> d{3, 4};
+
+        REQUIRE(sg.combine(std::deque<int>{1, 2}, d) == std::deque<int>{1, 2, 3, 4});
+        REQUIRE(sg.combine(d, std::deque<int>{5}) == std::deque<int>{3, 4, 5});
+        REQUIRE(sg.combine(d, 5) == std::deque<int>{3, 4, 5});
+        REQUIRE(d == std::deque<int>{3, 4});
+    }
+
+    SECTION("List") {
+        fl::Semigroup<std::list<std::string>> sg;
+        const std::list<std::string> l{"bar"};
+
+        REQUIRE(sg.combine(std::list<std::string>{"foo"}, l) == std::list<std::string>{"foo", "bar"});
+        REQUIRE(sg.combine(l, std::string("baz")) == std::list<std::string>{"bar", "baz"});
+        REQUIRE(l == std::list<std::string>{"bar"});
+    }
+
+    SECTION("Rvalue lists are spliced") {
+        std::list<std::string> acc{"foo"};
+        std::list<std::string> l{"bar", "baz"};
+        const auto *bar = &l.front();
+
+        fl::Semigroup<std::list<std::string>>().combine_into(acc, std::move(l));
+
+        REQUIRE(l.empty());
+        REQUIRE(acc == std::list<std::string>{"foo", "bar", "baz"});
+        REQUIRE(&*std::next(acc.begin()) == bar);
+    }
+
+    SECTION("User containers") {
+        fl::Semigroup<FlatLog> sg;
+        FlatLog log;
+        log.add("foo");
+
+        auto result = sg.combine(sg.combine(log, std::string("bar")), log);
+
+        REQUIRE(result.entries() == std::vector<std::string>{"foo", "bar", "foo"});
+    }
+
+    SECTION("Combine several") {
+        const std::deque<int> d{3, 4};
+        REQUIRE(fl::Semigroup<std::deque<int>>().combine(std::deque<int>{1, 2}, d, std::deque<int>{5}, d) ==
+                std::deque<int>{1, 2, 3, 4, 5, 3, 4});
+
+        std::list<std::string> l{"bar"};
+        const auto *bar = &l.front();
+        const auto list = fl::Semigroup<std::list<std::string>>().combine(std::list<std::string>{"foo"}, std::move(l),
+                                                                        std::list<std::string>{"baz"});
+        REQUIRE(list == std::list<std::string>{"foo", "bar", "baz"});
+        REQUIRE(&*std::next(list.begin()) == bar);
+    }
+
+    SECTION("Traits with reserve") {
+        fl::Semigroup<CountingLog> sg;
+
+        const auto result = sg.combine(CountingLog{1}, CountingLog{2, 3}, CountingLog{4, 5, 6});
+        REQUIRE(result == CountingLog{1, 2, 3, 4, 5, 6});
+        REQUIRE(result.capacity() == result.size());
+
+        CountingLog acc;
+        sg.reserve(acc, 10);
+        REQUIRE(acc.capacity() >= 10);
+
+        STATIC_REQUIRE(fl::_concepts::Reserving<fl::Monoid<CountingLog>, CountingLog>);
+        STATIC_REQUIRE(!fl::_concepts::Reserving<fl::Monoid<std::deque<int>>, std::deque<int>>);
+    }
+
+    SECTION("Customization overrides the default semigroup") {
+        CountingLog::appends = 0;
+
+        const auto result = fl::Semigroup<CountingLog>().combine(CountingLog{1}, CountingLog{2});
+
+        REQUIRE(result == CountingLog{1, 2});
+        REQUIRE(CountingLog::appends == 1);
+    }
+}
+
+TEST_CASE("Writer with customized containers") {
+    SECTION("List") {
+        using Logger = fl::Writer<std::list<std::string>, int>;
+
+        const auto w = Logger{{"foo"}, 1}
+            .tell(std::string("bar"))
+            .and_then([](int v) { return Logger{{"baz"}, v + 1}; });
+
+        REQUIRE(w.log() == std::list<std::string>{"foo", "bar", "baz"});
+        REQUIRE(w.value() == 2);
+    }
+
+    SECTION("Deque") {
+        using Logger = fl::Writer<std::deque<int>, int>;
+
+        REQUIRE(Logger{{1}, 1}.tell(2).tell(std::deque<int>{3, 4}).log() == std::deque<int>{1, 2, 3, 4});
+        REQUIRE(Logger{{1}, 1}.reset().log().empty());
+    }
+
+    SECTION("User containers") {
+        using Logger = fl::Writer<test_container_traits::FlatLog, int>;
+
+        const auto w = Logger{{}, 1}.tell(std::string("foo")).tell(std::string("bar"));
+
+        REQUIRE(w.log().entries() == std::vector<std::string>{"foo", "bar"});
+    }
+}
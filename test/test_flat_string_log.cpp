@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fl/semigroups/semigroup_flat_string_log.hpp>
+#include <fl/monoids/all.hpp>
+#include <fl/writer/writer.hpp>
+
+using Flat = fl::FlatStringLog;
+using Entries = std::vector<std::string_view>;
+
+namespace {
+
+Entries entries(const Flat &l) { return {l.begin(), l.end()}; }
+
+} // namespace
+
+TEST_CASE("Flat string log") {
+    SECTION("Push back") {
+        Flat l;
+        l.push_back("foo");
+        l.push_back(std::string(100, 'x'));
+        l.push_back("");
+
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.chars_size() == 103);
+        REQUIRE(l[0] == "foo");
+        REQUIRE(l[1] == std::string(100, 'x'));
+        REQUIRE(l.back().empty());
+    }
+
+    SECTION("Entries are contiguous") {
+        const Flat l{"foo", "bar", "baz"};
+
+        REQUIRE(l.chars() == "foobarbaz");
+        REQUIRE(l[1].data() == l[0].data() + 3);
+    }
+
+    SECTION("Append") {
+        Flat l{"foo"};
+        const Flat other{"bar", "baz"};
+
+        l.append(other);
+        l.append(l);
+
+        REQUIRE(entries(l) == Entries{"foo", "bar", "baz", "foo", "bar", "baz"});
+        REQUIRE(entries(other) == Entries{"bar", "baz"});
+    }
+
+    SECTION("Rvalue logs are adopted by empty logs") {
+        const std::string big(100, 'x');
+
+        Flat l;
+        Flat other{"foo", big};
+        const auto *data = other.chars().data();
+
+        l.append(std::move(other));
+
+        REQUIRE(l.chars().data() == data);
+        REQUIRE(entries(l) == Entries{"foo", big});
+    }
+
+    SECTION("Random access iterators") {
+        static_assert(std::random_access_iterator<Flat::const_iterator>);
+
+        const Flat l{"c", "a", "b"};
+
+        REQUIRE(l.end() - l.begin() == 3);
+        REQUIRE(l.begin()[2] == "b");
+        REQUIRE(*std::min_element(l.begin(), l.end()) == "a");
+    }
+}
+
+TEST_CASE("Flat string log semigroup") {
+    fl::Semigroup<Flat> sg;
+
+    SECTION("Combine logs") {
+        const Flat foo{"foo"};
+
+        REQUIRE(sg.combine(foo, Flat{"bar"}) == Flat{"foo", "bar"});
+        REQUIRE(sg.combine(Flat{"bar"}, foo) == Flat{"bar", "foo"});
+        REQUIRE(sg.combine(foo, foo) == Flat{"foo", "foo"});
+        REQUIRE(foo == Flat{"foo"});
+    }
+
+    SECTION("Combine with entries") {
+        REQUIRE(sg.combine(Flat{"foo"}, "bar") == Flat{"foo", "bar"});
+        REQUIRE(sg.combine(Flat{"foo"}, std::string("bar")) == Flat{"foo", "bar"});
+        REQUIRE(sg.combine(Flat{"foo"}, std::string_view("bar")) == Flat{"foo", "bar"});
+    }
+
+    SECTION("Entry boundaries are kept") {
+        REQUIRE(sg.combine(Flat{"foo"}, Flat{"bar"}) != Flat{"foob", "ar"});
+    }
+
+    SECTION("Associativity") {
+        REQUIRE(sg.combine(Flat{"baz"}, sg.combine(Flat{"foo"}, Flat{"bar"})) ==
+                sg.combine(sg.combine(Flat{"baz"}, Flat{"foo"}), Flat{"bar"}));
+    }
+}
+
+TEST_CASE("Writer with flat string log") {
+    using Logger = fl::Writer<Flat, int>;
+
+    const auto w = Logger{{"foo"}, 1}
+        .tell("bar")
+        .and_then([](int v) { return Logger{{"baz"}, v + 1}; });
+
+    REQUIRE(entries(w.log()) == Entries{"foo", "bar", "baz"});
+    REQUIRE(w.value() == 2);
+    REQUIRE(Logger{{"foo"}, 1}.reset().log().empty());
+}
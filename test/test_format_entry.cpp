@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <fmt/ranges.h>
+
+#include <fl/writer/all.hpp>
+#include <fl/fmt/format_entry.hpp>
+
+using FormatLogger = fl::Writer<fl::FormatLog, int>;
+
+namespace {
+
+// Counts formatting
+struct Counted {
+    static inline int formatted = 0;
+
+    int value;
+};
+
+} // namespace
+
+template <>
+struct fmt::formatter<Counted> : fmt::formatter<int> {
+    auto format(const Counted &c, fmt::format_context &ctx) const {
+        ++Counted::formatted;
+        return fmt::formatter<int>::format(c.value, ctx);
+    }
+};
+
+TEST_CASE("Format entry") {
+    Counted::formatted = 0;
+
+    SECTION("Format") {
+        const fl::FormatEntry e("{} + {} = {}", 1, 2.5, std::string("3.5"));
+
+        REQUIRE(e.str() == "1 + 2.5 = 3.5");
+        REQUIRE(fmt::format("[{}]", e) == "[1 + 2.5 = 3.5]");
+    }
+
+    SECTION("Formatting is deferred") {
+        const fl::FormatEntry e("Value is {}", Counted{42});
+        REQUIRE(Counted::formatted == 0);
+
+        REQUIRE(e.str() == "Value is 42");
+        REQUIRE(Counted::formatted == 1);
+    }
+
+    SECTION("Large arguments") {
+        const std::string big(100, 'x');
+        const fl::FormatEntry e("{}{}{}{}", big, big, 1, big);
+
+        REQUIRE(sizeof(std::tuple<std::string, std::string, int, std::string>) > fl::FormatEntry::inline_size);
+        REQUIRE(e.str() == big + big + "1" + big);
+    }
+
+    SECTION("Copy and move") {
+        for (const auto &arg : {std::string("foo"), std::string(100, 'x')}) {
+            fl::FormatEntry e("{}{}{}", arg, arg, arg);
+            const auto expected = arg + arg + arg;
+
+            fl::FormatEntry copy(e);
+            REQUIRE(copy.str() == expected);
+
+            fl::FormatEntry moved(std::move(copy));
+            REQUIRE(moved.str() == expected);
+
+            fl::FormatEntry assigned("{}", 1);
+            assigned = moved;
+            REQUIRE(assigned.str() == expected);
+
+            assigned = fl::FormatEntry("{}", 2);
+            REQUIRE(assigned.str() == "2");
+
+            e = std::move(moved);
+            REQUIRE(e == fl::FormatEntry("{}", expected));
+        }
+    }
+}
+
+TEST_CASE("Tell fmt") {
+    Counted::formatted = 0;
+
+    SECTION("Entries are formatted when read") {
+        const auto w = fl::tell_fmt(FormatLogger{{}, 1}, "Value is {}", Counted{1})
+            .and_then([](int v) { return fl::tell_fmt(FormatLogger{{}, v + 1}, "Value is {}", Counted{v + 1}); });
+
+        REQUIRE(Counted::formatted == 0);
+        REQUIRE(fmt::format("{}", fmt::join(w.log(), "; ")) == "Value is 1; Value is 2");
+        REQUIRE(Counted::formatted == 2);
+    }
+
+    SECTION("Dropped logs are not formatted") {
+        const auto w = fl::tell_fmt(FormatLogger{{}, 1}, "Value is {}", Counted{1}).reset();
+
+        REQUIRE(w.log().empty());
+        REQUIRE(Counted::formatted == 0);
+    }
+
+    SECTION("Leveled entries") {
+        using Logger = fl::Writer<std::vector<fl::Leveled<fl::FormatEntry>>, int>;
+        const fl::filters::Threshold filter{fl::Level::Info};
+
+        const auto w = fl::tell_at<fl::Level::Warn>(Logger{{}, 1}, filter, [](int v) {
+            return fl::FormatEntry("Value is {}", v);
+        });
+
+        REQUIRE(w.log().front().entry.str() == "Value is 1");
+    }
+
+    SECTION("Null log") {
+        const auto w = fl::tell_fmt(fl::Writer<fl::NullLog, int>{{}, 1}, "Value is {}", Counted{1});
+
+        REQUIRE(w.value() == 1);
+    }
+}
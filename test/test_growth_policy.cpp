@@ -0,0 +1,115 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <fl/semigroups/all.hpp>
+#include <fl/writer/writer.hpp>
+
+#include <vector>
+
+namespace test_growth_policy {
+
+struct ExactLog : std::vector<int> { using std::vector<int>::vector; };
+struct ChunkedLog : std::vector<int> { using std::vector<int>::vector; };
+struct FactorLog : std::vector<int> { using std::vector<int>::vector; };
+
+template <class Log>
+std::size_t reallocations(std::size_t combines) {
+    fl::Semigroup<Log> sg;
+
+    Log log;
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < combines; ++i) {
+        const auto capacity = log.capacity();
+        log = sg.combine(std::move(log), Log{int(i)});
+        result += log.capacity() != capacity;
+    }
+
+    return result;
+}
+
+} // namespace test_growth_policy
+
+template <>
+struct fl::growth_policy<test_growth_policy::ExactLog> { using type = fl::growth::Exact; };
+
+template <>
+struct fl::growth_policy<test_growth_policy::ChunkedLog> { using type = fl::growth::Chunked<100>; };
+
+template <>
+struct fl::growth_policy<test_growth_policy::FactorLog> { using type = fl::growth::Factor<3, 2>; };
+
+TEST_CASE("Growth policies") {
+    SECTION("Exact") {
+        REQUIRE(fl::growth::Exact::capacity(10, 11) == 11);
+    }
+
+    SECTION("Factor") {
+        REQUIRE(fl::growth::Factor<2>::capacity(10, 11) == 20);
+        REQUIRE(fl::growth::Factor<3, 2>::capacity(10, 11) == 15);
+        REQUIRE(fl::growth::Factor<2>::capacity(10, 42) == 42);
+        REQUIRE(fl::growth::Factor<2>::capacity(0, 1) == 1);
+    }
+
+    SECTION("Chunked") {
+        REQUIRE(fl::growth::Chunked<8>::capacity(8, 9) == 16);
+        REQUIRE(fl::growth::Chunked<8>::capacity(0, 8) == 8);
+    }
+
+    SECTION("Default") {
+        static_assert(std::is_same_v<fl::growth_policy_t<std::vector<int>>, fl::growth::Geometric>);
+        static_assert(std::is_same_v<fl::growth_policy_t<const test_growth_policy::ExactLog &>, fl::growth::Exact>);
+    }
+}
+
+TEST_CASE("Container semigroup growth") {
+    using namespace test_growth_policy;
+
+    const std::size_t combines = 10'000;
+
+    SECTION("Geometric by default") {
+        REQUIRE(reallocations<std::vector<int>>(combines) < 20);
+    }
+
+    SECTION("Exact") {
+        REQUIRE(reallocations<ExactLog>(combines) == combines);
+    }
+
+    SECTION("Chunked") {
+        REQUIRE(reallocations<ChunkedLog>(combines) == combines / 100);
+    }
+
+    SECTION("Factor") {
+        REQUIRE(reallocations<FactorLog>(combines) < 30);
+    }
+
+    SECTION("Lvalue combine reserves exactly") {
+        const std::vector<int> v1{1, 2, 3};
+        const std::vector<int> v2{4, 5};
+
+        REQUIRE(fl::Semigroup<std::vector<int>>().combine(v1, v2).capacity() == 5);
+    }
+
+    SECTION("Writer and then") {
+        using Logger = fl::Writer<std::vector<int>, int>;
+
+        Logger w{};
+        std::size_t reallocations = 0;
+        for (int i = 0; i < int(combines); ++i) {
+            const auto capacity = w.log_.capacity();
+            w = std::move(w).and_then([&](int v) { return Logger{{i}, v + 1}; });
+            reallocations += w.log_.capacity() != capacity;
+        }
+
+        REQUIRE(w.log_.size() == combines);
+        REQUIRE(reallocations < 20);
+    }
+}
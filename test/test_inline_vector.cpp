@@ -0,0 +1,136 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <string>
+
+#include <fl/writer/all.hpp>
+
+using Small = fl::SmallVector<std::string, 2>;
+using Static = fl::StaticVector<int, 4>;
+using Dropping = fl::StaticVector<int, 2, fl::overflow::Drop>;
+
+namespace {
+
+constexpr Static constexprLog() {
+    using Logger = fl::Writer<Static, int>;
+    return Logger{{1}, 1}.tell(2).and_then([](int v) { return Logger{{3}, v + 1}; }).tell(Static{4}).log();
+}
+
+constexpr std::size_t constexprSpill() {
+    fl::SmallVector<int, 2> v{1, 2};
+    v = fl::Semigroup<fl::SmallVector<int, 2>>().combine(std::move(v), fl::SmallVector<int, 2>{3, 4});
+    return v.spilled() ? v.size() : 0;
+}
+
+} // namespace
+
+TEST_CASE("Inline vector") {
+    SECTION("Entries are stored in place") {
+        Small v{"foo", "bar"};
+
+        REQUIRE(v.size() == 2);
+        REQUIRE(!v.spilled());
+        REQUIRE(static_cast<const void *>(v.data()) >= static_cast<const void *>(&v));
+        REQUIRE(static_cast<const void *>(v.data() + v.size()) <= static_cast<const void *>(&v + 1));
+    }
+
+    SECTION("Spill") {
+        Small v{"foo", "bar"};
+        v.push_back("baz");
+
+        REQUIRE(v.spilled());
+        REQUIRE(v.size() == 3);
+        REQUIRE(v.capacity() >= 3);
+        REQUIRE(v == Small{"foo", "bar", "baz"});
+    }
+
+    SECTION("Drop") {
+        Dropping v{1, 2, 3};
+        v.push_back(4);
+
+        REQUIRE(v == Dropping{1, 2});
+        REQUIRE(v.dropped() == 2);
+        REQUIRE(v.capacity() == 2);
+    }
+
+    SECTION("Copy and move") {
+        const Small inPlace{"foo"};
+        const Small spilled{"foo", "bar", "baz"};
+
+        auto copy = spilled;
+        REQUIRE(copy == spilled);
+        REQUIRE(copy.spilled());
+
+        auto moved = std::move(copy);
+        REQUIRE(moved == spilled);
+        REQUIRE(copy.empty()); // NOLINT
+
+        moved = inPlace;
+        REQUIRE(moved == inPlace);
+        REQUIRE(!moved.spilled());
+    }
+
+    SECTION("Clear") {
+        Small v{"foo", "bar", "baz"};
+        v.clear();
+
+        REQUIRE(v.empty());
+        REQUIRE(!v.spilled());
+    }
+
+    SECTION("Constant expressions") {
+        static_assert(constexprLog() == Static{1, 2, 3, 4});
+        static_assert(constexprSpill() == 4);
+    }
+}
+
+TEST_CASE("Inline vector semigroup") {
+    SECTION("Combine") {
+        fl::Semigroup<Small> sg;
+        const Small foo{"foo"};
+
+        REQUIRE(sg.combine(foo, Small{"bar"}) == Small{"foo", "bar"});
+        REQUIRE(sg.combine(foo, std::string("bar")) == Small{"foo", "bar"});
+        REQUIRE(sg.combine(sg.combine(foo, foo), foo) == Small{"foo", "foo", "foo"});
+        REQUIRE(foo == Small{"foo"});
+    }
+
+    SECTION("Spilled rvalues are adopted") {
+        Small acc;
+        Small v{"foo", "bar", "baz"};
+        const auto *data = v.data();
+
+        fl::Semigroup<Small>().combine_into(acc, std::move(v));
+
+        REQUIRE(acc.data() == data);
+        REQUIRE(acc == Small{"foo", "bar", "baz"});
+    }
+
+    SECTION("Dropped entries are counted") {
+        const auto result = fl::Semigroup<Dropping>().combine(Dropping{1, 2, 3}, Dropping{4});
+
+        REQUIRE(result == Dropping{1, 2});
+        REQUIRE(result.dropped() == 2);
+    }
+}
+
+TEST_CASE("Writer with inline vector") {
+    using Logger = fl::Writer<Small, int>;
+
+    const auto w = Logger{{"foo"}, 1}
+        .tell(std::string("bar"))
+        .and_then([](int v) { return Logger{{"baz"}, v + 1}; });
+
+    REQUIRE(w.log() == Small{"foo", "bar", "baz"});
+    REQUIRE(w.value() == 2);
+    REQUIRE(Logger{{"foo"}, 1}.reset().log().empty());
+}
@@ -0,0 +1,108 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <fl/logs/interned.hpp>
+#include <fl/writer/all.hpp>
+
+TEST_CASE("String table") {
+    fl::StringTable table;
+
+    SECTION("Equal strings have equal identifiers") {
+        const auto foo = table.intern("foo");
+        const auto bar = table.intern(std::string("bar"));
+
+        REQUIRE(foo != bar);
+        REQUIRE(table.intern(std::string_view("foo")) == foo);
+        REQUIRE(table.str(foo) == "foo");
+        REQUIRE(table.str(bar) == "bar");
+        REQUIRE(table.size() == 2);
+    }
+
+    SECTION("Views stay valid") {
+        const auto foo = table.str(table.intern("foo"));
+        for (int i = 0; i < 1'000; ++i) {
+            std::ignore = table.intern(std::to_string(i));
+        }
+
+        REQUIRE(foo == "foo");
+    }
+
+    SECTION("Concurrent interning") {
+        std::vector<fl::StringTable::Id> ids(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            threads.emplace_back([&, i] {
+                for (int j = 0; j < 100; ++j) {
+                    std::ignore = table.intern(std::to_string(j));
+                }
+                ids[i] = table.intern("foo");
+            });
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+
+        REQUIRE(std::all_of(ids.begin(), ids.end(), [&](auto id) { return id == ids.front(); }));
+        REQUIRE(table.size() == 101);
+    }
+}
+
+TEST_CASE("Interned entries") {
+    SECTION("Size") {
+        static_assert(sizeof(fl::Interned<>) == 4);
+        static_assert(sizeof(fl::Interned<std::uint32_t>) == 8);
+    }
+
+    SECTION("Intern") {
+        const auto e = fl::intern("Cache miss");
+
+        REQUIRE(e == fl::intern(std::string("Cache miss")));
+        REQUIRE(e != fl::intern("Cache hit"));
+        REQUIRE(e.str() == "Cache miss");
+    }
+
+    SECTION("Payload") {
+        const auto e = fl::intern("Request took, ms:", 42);
+
+        REQUIRE(e.payload == 42);
+        REQUIRE(e.id == fl::intern("Request took, ms:").id);
+        REQUIRE(e != fl::intern("Request took, ms:", 43));
+    }
+
+    SECTION("Write to stream") {
+        std::ostringstream os;
+        os << fl::intern("foo") << "; " << fl::intern("bar", 42);
+
+        REQUIRE(os.str() == "foo; bar 42");
+    }
+}
+
+TEST_CASE("Writer with interned log") {
+    using Logger = fl::Writer<fl::InternedLog<>, int>;
+
+    const auto w = Logger{{fl::intern("foo")}, 1}
+        .tell(fl::intern("bar"))
+        .and_then([](int v) { return Logger{{fl::intern("foo")}, v + 1}; });
+
+    std::vector<std::string_view> messages;
+    for (const auto &e : w.log()) {
+        messages.push_back(e.str());
+    }
+
+    REQUIRE(messages == std::vector<std::string_view>{"foo", "bar", "foo"});
+    REQUIRE(w.log().front() == w.log().back());
+    REQUIRE(w.value() == 2);
+}
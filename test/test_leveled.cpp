@@ -0,0 +1,173 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <sstream>
+
+#include <fl/writer/all.hpp>
+
+using Entry = fl::Leveled<std::string>;
+using LeveledLog = std::vector<Entry>;
+using LeveledLogger = fl::Writer<LeveledLog, int>;
+
+namespace {
+
+// Counts created entries
+struct Make {
+    std::string operator()(int v) const {
+        ++*calls;
+        return std::to_string(v);
+    }
+
+    int *calls;
+};
+
+} // namespace
+
+TEST_CASE("Levels") {
+    SECTION("Order") {
+        REQUIRE(fl::Level::Trace < fl::Level::Debug);
+        REQUIRE(fl::Level::Error < fl::Level::Critical);
+        REQUIRE(fl::Level::Critical < fl::Level::Off);
+    }
+
+    SECTION("To string") {
+        REQUIRE(fl::to_string(fl::Level::Warn) == "warn");
+
+        std::ostringstream os;
+        os << fl::Level::Debug;
+        REQUIRE(os.str() == "debug");
+    }
+
+    SECTION("Leveled entry") {
+        const fl::Leveled e{fl::Level::Info, std::string("foo")};
+
+        REQUIRE(e == Entry{fl::Level::Info, "foo"});
+        REQUIRE(e < Entry{fl::Level::Warn, "bar"});
+    }
+}
+
+TEST_CASE("Filters") {
+    SECTION("Threshold") {
+        fl::filters::Threshold f{fl::Level::Warn};
+
+        REQUIRE_FALSE(f(fl::Level::Info));
+        REQUIRE(f(fl::Level::Warn));
+        REQUIRE(f(fl::Level::Error));
+        REQUIRE_FALSE(f(fl::Level::Off));
+
+        f.min = fl::Level::Trace;
+        REQUIRE(f(fl::Level::Trace));
+    }
+
+    SECTION("Static threshold") {
+        using F = fl::filters::StaticThreshold<fl::Level::Info>;
+
+        static_assert(!F::compiled_in<fl::Level::Debug>);
+        static_assert(F::compiled_in<fl::Level::Info>);
+        static_assert(F{}(fl::Level::Error));
+        static_assert(fl::details::compiled_in<fl::filters::Threshold, fl::Level::Trace>);
+    }
+
+    SECTION("Sampling") {
+        fl::filters::Sampling f(3);
+
+        std::vector<bool> passed;
+        for (int i = 0; i < 7; ++i) {
+            passed.push_back(f(fl::Level::Debug));
+        }
+
+        REQUIRE(passed == std::vector<bool>{true, false, false, true, false, false, true});
+    }
+}
+
+TEST_CASE("Tell if") {
+    int calls = 0;
+    const Make make{&calls};
+
+    SECTION("Passed") {
+        const auto w = LeveledLogger{{}, 1}.tell_if([] { return true; }, [&](int v) {
+            return Entry{fl::Level::Info, make(v)};
+        });
+
+        REQUIRE(w.log() == LeveledLog{{fl::Level::Info, "1"}});
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Filtered out") {
+        const LeveledLogger w{{{fl::Level::Info, "foo"}}, 1};
+        const auto r = w.tell_if([] { return false; }, [&](int v) { return Entry{fl::Level::Info, make(v)}; });
+
+        REQUIRE(r == w);
+        REQUIRE(calls == 0);
+    }
+
+    SECTION("Null log") {
+        bool checked = false;
+        const auto r = fl::Writer<fl::NullLog, int>{{}, 1}.tell_if([&] { return checked = true; }, make);
+
+        REQUIRE(r.value() == 1);
+        REQUIRE_FALSE(checked);
+        REQUIRE(calls == 0);
+    }
+}
+
+TEST_CASE("Tell at") {
+    int calls = 0;
+    const Make make{&calls};
+
+    SECTION("Runtime threshold") {
+        fl::filters::Threshold filter{fl::Level::Info};
+
+        auto w = LeveledLogger{{}, 1};
+        w = fl::tell_at<fl::Level::Debug>(std::move(w), filter, make);
+        w = fl::tell_at<fl::Level::Warn>(std::move(w), filter, make);
+
+        filter.min = fl::Level::Debug;
+        w = fl::tell_at<fl::Level::Debug>(std::move(w), filter, make);
+
+        REQUIRE(w.log() == LeveledLog{{fl::Level::Warn, "1"}, {fl::Level::Debug, "1"}});
+        REQUIRE(calls == 2);
+    }
+
+    SECTION("Compile-time threshold") {
+        const fl::filters::StaticThreshold<fl::Level::Warn> filter;
+        const LeveledLogger w{{}, 1};
+
+        REQUIRE(fl::tell_at<fl::Level::Trace>(w, filter, make) == w);
+        REQUIRE(fl::tell_at<fl::Level::Error>(w, filter, make).log() == LeveledLog{{fl::Level::Error, "1"}});
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("Sampling") {
+        fl::filters::Sampling filter(10);
+
+        auto w = LeveledLogger{{}, 1};
+        for (int i = 0; i < 100; ++i) {
+            w = fl::tell_at<fl::Level::Debug>(std::move(w), filter, make);
+        }
+
+        REQUIRE(w.log().size() == 10);
+        REQUIRE(calls == 10);
+    }
+
+    SECTION("And then") {
+        const fl::filters::Threshold filter{fl::Level::Info};
+
+        const auto w = LeveledLogger{{}, 1}.and_then([&](int v) {
+            return fl::tell_at<fl::Level::Info>(LeveledLogger{{}, v + 1}, filter, [](int v) {
+                return "Value is " + std::to_string(v);
+            });
+        });
+
+        REQUIRE(w.log() == LeveledLog{{fl::Level::Info, "Value is 2"}});
+    }
+}
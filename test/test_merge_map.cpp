@@ -0,0 +1,135 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <unordered_map>
+
+#include <fl/writer/all.hpp>
+
+using Counters = fl::MergeMap<std::string, std::uint64_t>;
+using CountersLogger = fl::Writer<Counters, int>;
+
+TEST_CASE("Merge map") {
+    SECTION("Values of equal keys are combined") {
+        Counters c;
+        c.add("foo", 1).add("bar", 2).add("foo", 3);
+        c.add(std::pair{"bar", 1});
+
+        REQUIRE(c.size() == 2);
+        REQUIRE(c.at("foo") == 4);
+        REQUIRE(c.at("bar") == 3);
+    }
+
+    SECTION("Initializer list") {
+        const Counters c{{"foo", 1}, {"foo", 2}};
+
+        REQUIRE(c == Counters{{"foo", 3}});
+    }
+
+    SECTION("Merge") {
+        Counters c1{{"foo", 1}, {"bar", 2}};
+        const Counters c2{{"foo", 3}, {"baz", 4}};
+
+        c1.merge(c2);
+        REQUIRE(c1 == Counters{{"foo", 4}, {"bar", 2}, {"baz", 4}});
+        REQUIRE(c2 == Counters{{"foo", 3}, {"baz", 4}});
+
+        c1.merge(Counters{{"baz", 1}, {"qux", 1}});
+        REQUIRE(c1 == Counters{{"foo", 4}, {"bar", 2}, {"baz", 5}, {"qux", 1}});
+    }
+
+    SECTION("Merge with itself") {
+        Counters c{{"foo", 1}, {"bar", 2}};
+
+        c.merge(c);
+        REQUIRE(c == Counters{{"foo", 2}, {"bar", 4}});
+
+        c.merge(std::move(c));
+        REQUIRE(c == Counters{{"foo", 4}, {"bar", 8}});
+    }
+
+    SECTION("Nodes of new keys are moved") {
+        Counters c1{{"foo", 1}};
+        Counters c2{{"bar", 1}};
+        const auto *bar = &c2.at("bar");
+
+        c1.merge(std::move(c2));
+
+        REQUIRE(&c1.at("bar") == bar);
+        REQUIRE(c2.empty());
+    }
+
+    SECTION("Other values") {
+        using Names = fl::MergeMap<int, std::vector<std::string>, std::unordered_map<int, std::vector<std::string>>>;
+
+        Names n;
+        n.add(1, std::vector<std::string>{"foo"}).add(1, "bar").add(2, std::vector<std::string>{"baz"});
+
+        REQUIRE(n.at(1) == std::vector<std::string>{"foo", "bar"});
+        REQUIRE(n.at(2) == std::vector<std::string>{"baz"});
+    }
+
+    SECTION("Nested maps") {
+        using Nested = fl::MergeMap<std::string, Counters>;
+
+        Nested n;
+        n.add("GET", Counters{{"/", 1}}).add("GET", Counters{{"/", 1}, {"/foo", 1}});
+
+        REQUIRE(n.at("GET") == Counters{{"/", 2}, {"/foo", 1}});
+    }
+}
+
+TEST_CASE("Merge map semigroup") {
+    fl::Semigroup<Counters> sg;
+
+    SECTION("Combine") {
+        const Counters c1{{"foo", 1}};
+        const Counters c2{{"foo", 2}, {"bar", 1}};
+
+        REQUIRE(sg.combine(c1, c2) == Counters{{"foo", 3}, {"bar", 1}});
+        REQUIRE(sg.combine(c1, std::pair{"foo", 1}) == Counters{{"foo", 2}});
+        REQUIRE(c1 == Counters{{"foo", 1}});
+    }
+
+    SECTION("Associativity") {
+        const Counters a{{"foo", 1}};
+        const Counters b{{"foo", 2}, {"bar", 1}};
+        const Counters c{{"bar", 3}};
+
+        REQUIRE(sg.combine(a, sg.combine(b, c)) == sg.combine(sg.combine(a, b), c));
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<Counters> m;
+        const Counters c{{"foo", 1}};
+
+        REQUIRE(m.combine(m.identity(), c) == c);
+        REQUIRE(m.combine(c, m.identity()) == c);
+    }
+}
+
+TEST_CASE("Writer with merge map") {
+    SECTION("Aggregate counters") {
+        auto w = CountersLogger{{}, 0};
+        for (int i = 0; i < 10; ++i) {
+            w = std::move(w)
+                .tell(std::pair{"calls", 1})
+                .and_then([](int v) { return CountersLogger{{{v % 2 ? "odd" : "even", 1}}, v + 1}; });
+        }
+
+        REQUIRE(w.log() == Counters{{"calls", 10}, {"odd", 5}, {"even", 5}});
+        REQUIRE(w.value() == 10);
+    }
+
+    SECTION("Reset") {
+        REQUIRE(CountersLogger{{{"foo", 1}}, 0}.reset().log().empty());
+    }
+}
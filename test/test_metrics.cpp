@@ -0,0 +1,263 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <array>
+#include <string>
+#include <valarray>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Latency = fl::Histogram<0, 100, 10>;
+using Hdr = fl::HdrHistogram<3, 20>;
+
+template <class T>
+std::vector<T> elements(const std::valarray<T> &v) { return {std::begin(v), std::end(v)}; }
+
+} // namespace
+
+TEST_CASE("Element-wise semigroups") {
+    SECTION("Arrays of numbers are added") {
+        fl::Semigroup<std::array<int, 3>> sg;
+
+        REQUIRE(sg.combine(std::array{1, 2, 3}, std::array{10, 20, 30}) == std::array{11, 22, 33});
+    }
+
+    SECTION("Arrays of other types are combined with their semigroups") {
+        fl::Semigroup<std::array<std::string, 2>> sg;
+        const std::array<std::string, 2> foo{"a", "b"};
+
+        REQUIRE(sg.combine(foo, foo) == std::array<std::string, 2>{"aa", "bb"});
+    }
+
+    SECTION("Long arrays and arrays combined with themselves") {
+        fl::Semigroup<std::array<int, 37>> sg;
+        std::array<int, 37> a{};
+        std::array<int, 37> expected{};
+        for (int i = 0; i < 37; ++i) {
+            a[i] = i;
+            expected[i] = 3 * i;
+        }
+        const auto original = a;
+
+        sg.combine_into(a, std::as_const(a));
+        REQUIRE(sg.combine(a, original) == expected);
+
+        fl::Semigroup<std::valarray<int>> vsg;
+        std::valarray<int> v(1, 37);
+        vsg.combine_into(v, v);
+        REQUIRE(elements(v) == std::vector<int>(37, 2));
+    }
+
+    SECTION("Identity of arrays") {
+        fl::Monoid<std::array<int, 3>> m;
+
+        REQUIRE(m.combine(m.identity(), std::array{1, 2, 3}) == std::array{1, 2, 3});
+    }
+
+    SECTION("Valarrays of the same size") {
+        fl::Semigroup<std::valarray<int>> sg;
+
+        REQUIRE(elements(sg.combine(std::valarray{1, 2}, std::valarray{3, 4})) == std::vector{4, 6});
+    }
+
+    SECTION("Shorter valarrays are padded with zeros") {
+        fl::Semigroup<std::valarray<int>> sg;
+        const std::valarray<int> shorter{1, 2};
+        const std::valarray<int> longer{10, 20, 30};
+
+        REQUIRE(elements(sg.combine(shorter, longer)) == std::vector{11, 22, 30});
+        REQUIRE(elements(sg.combine(longer, shorter)) == std::vector{11, 22, 30});
+    }
+
+    SECTION("Identity of valarrays") {
+        fl::Monoid<std::valarray<int>> m;
+
+        REQUIRE(elements(m.combine(m.identity(), std::valarray{1, 2})) == std::vector{1, 2});
+        REQUIRE(elements(m.combine(std::valarray{1, 2}, m.identity())) == std::vector{1, 2});
+    }
+
+    SECTION("Compile time") {
+        constexpr auto sum = fl::Semigroup<std::array<int, 2>>().combine(std::array{1, 2}, std::array{3, 4});
+        static_assert(sum == std::array{4, 6});
+    }
+}
+
+TEST_CASE("Counter") {
+    fl::Semigroup<fl::Counter<>> sg;
+
+    REQUIRE(sg.combine(fl::Counter<>(1), fl::Counter<>(2)).value() == 3);
+    REQUIRE(sg.combine(fl::Counter<>(), 5).value() == 5);
+    REQUIRE(fl::Monoid<fl::Counter<>>().identity().value() == 0);
+}
+
+TEST_CASE("Stats") {
+    fl::Semigroup<fl::Stats<>> sg;
+
+    SECTION("Samples") {
+        const auto s = sg.combine(sg.combine(fl::Stats<>(), 2.0), 4);
+
+        REQUIRE(s.count() == 2);
+        REQUIRE(s.sum() == 6.0);
+        REQUIRE(s.min() == 2.0);
+        REQUIRE(s.max() == 4.0);
+        REQUIRE(s.mean() == 3.0);
+    }
+
+    SECTION("Merge") {
+        fl::Semigroup<fl::Stats<int>> ints;
+        const auto s = ints.combine(fl::Stats<int>().add(1).add(5), fl::Stats<int>().add(-3));
+
+        REQUIRE(s.count() == 3);
+        REQUIRE(s.sum() == 3);
+        REQUIRE(s.min() == -3);
+        REQUIRE(s.max() == 5);
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<fl::Stats<int>> m;
+        const auto s = fl::Stats<int>().add(7);
+
+        REQUIRE(m.identity().empty());
+        REQUIRE(m.identity().mean() == 0.0);
+        REQUIRE(m.combine(m.identity(), s) == s);
+        REQUIRE(m.combine(s, m.identity()) == s);
+    }
+}
+
+TEST_CASE("Histogram") {
+    SECTION("Buckets") {
+        REQUIRE(Latency::bucket_of(-5) == 0);
+        REQUIRE(Latency::bucket_of(0) == 0);
+        REQUIRE(Latency::bucket_of(9) == 0);
+        REQUIRE(Latency::bucket_of(10) == 1);
+        REQUIRE(Latency::bucket_of(99) == 9);
+        REQUIRE(Latency::bucket_of(1000) == 9);
+        REQUIRE(Latency::lower_bound(3) == 30);
+
+        using Uneven = fl::Histogram<0, 10, 3>;
+        for (int v = 0; v < 10; ++v) {
+            REQUIRE(Uneven::lower_bound(Uneven::bucket_of(v)) <= v);
+        }
+        for (std::size_t i = 0; i < 3; ++i) {
+            REQUIRE(Uneven::bucket_of(Uneven::lower_bound(i)) == i);
+        }
+    }
+
+    SECTION("Floating point bounds") {
+        using Seconds = fl::Histogram<0.0, 1.0, 4>;
+
+        REQUIRE(Seconds::bucket_of(0.3) == 1);
+        REQUIRE(Seconds::lower_bound(2) == 0.5);
+    }
+
+    SECTION("Merge") {
+        fl::Semigroup<Latency> sg;
+        const auto h = sg.combine(Latency().record(5).record(15), Latency().record(17, 2));
+
+        REQUIRE(h.total() == 4);
+        REQUIRE(h.buckets()[0] == 1);
+        REQUIRE(h.buckets()[1] == 3);
+    }
+
+    SECTION("Quantiles") {
+        Latency h;
+        for (int v = 0; v < 100; ++v) {
+            h.record(v);
+        }
+
+        REQUIRE(h.value_at_quantile(0.0) == 0);
+        REQUIRE(h.value_at_quantile(0.5) == 40);
+        REQUIRE(h.value_at_quantile(0.99) == 90);
+        REQUIRE(Latency().value_at_quantile(0.5) == 0);
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<Latency> m;
+        const auto h = Latency().record(42);
+
+        REQUIRE(m.combine(m.identity(), h) == h);
+    }
+}
+
+TEST_CASE("HDR histogram") {
+    SECTION("Small values are exact") {
+        for (std::uint64_t v = 0; v < 8; ++v) {
+            REQUIRE(Hdr::bucket_of(v) == v);
+            REQUIRE(Hdr::lower_bound(v) == v);
+        }
+    }
+
+    SECTION("Relative error is bounded") {
+        for (std::uint64_t v = 1; v < (1u << 20); v = v * 3 / 2 + 1) {
+            const auto lower = Hdr::lower_bound(Hdr::bucket_of(v));
+
+            REQUIRE(lower <= v);
+            REQUIRE(double(v - lower) / double(v) <= 1.0 / 8);
+        }
+    }
+
+    SECTION("Buckets are contiguous") {
+        for (std::size_t i = 0; i < Hdr::bucket_count; ++i) {
+            REQUIRE(Hdr::bucket_of(Hdr::lower_bound(i)) == i);
+        }
+        REQUIRE(Hdr::bucket_of(Hdr::max_value) == Hdr::bucket_count - 1);
+        REQUIRE(Hdr::bucket_of(std::uint64_t(-1)) == Hdr::bucket_count - 1);
+    }
+
+    SECTION("Buckets are allocated on demand") {
+        Hdr h;
+        REQUIRE(h.buckets().size() == 0);
+
+        h.record(100);
+        REQUIRE(h.buckets().size() == Hdr::bucket_count);
+    }
+
+    SECTION("Merge") {
+        fl::Monoid<Hdr> m;
+        const auto h = Hdr().record(1).record(1000);
+
+        REQUIRE(m.combine(m.identity(), h) == h);
+        REQUIRE(m.combine(h, m.identity()) == h);
+
+        const auto twice = m.combine(h, h);
+        REQUIRE(twice.total() == 4);
+        REQUIRE(twice.buckets()[Hdr::bucket_of(1000)] == 2);
+    }
+
+    SECTION("Quantiles") {
+        Hdr h;
+        for (std::uint64_t v = 1; v <= 1000; ++v) {
+            h.record(v);
+        }
+
+        const auto median = h.value_at_quantile(0.5);
+        REQUIRE(median <= 500);
+        REQUIRE(median >= 500 - 500 / 8);
+        REQUIRE(h.value_at_quantile(1.0) == Hdr::lower_bound(Hdr::bucket_of(1000)));
+    }
+}
+
+TEST_CASE("Writer with metrics") {
+    using Logger = fl::Writer<Latency, int>;
+
+    const auto w = Logger{{}, 1}
+        .tell(5)
+        .and_then([](int v) { return Logger{Latency().record(50), v + 1}; })
+        .tell(55);
+
+    REQUIRE(w.value() == 2);
+    REQUIRE(w.log().total() == 3);
+    REQUIRE(w.log().value_at_quantile(1.0) == 50);
+}
@@ -13,6 +13,12 @@
 #include <fl/monoids/all.hpp>
 #include <fl/semigroups/all.hpp>
 
+#include <list>
+#include <ranges>
+#include <set>
+#include <string>
+#include <vector>
+
 TEST_CASE("Identity") {
     SECTION("Int") {
         auto m = fl::Monoid<int>();
@@ -38,4 +44,56 @@ TEST_CASE("Identity") {
         REQUIRE(m.combine(m.identity(), Vec{"1", "2", "3"}) == Vec{"1", "2", "3"});
         REQUIRE(m.combine(Vec{"1", "2", "3"}, m.identity()) == Vec{"1", "2", "3"});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Concat") {
+    SECTION("Empty") {
+        REQUIRE(fl::mconcat(std::vector<int>{}) == 0);
+        REQUIRE(fl::mconcat(std::vector<std::string>{}).empty());
+    }
+
+    SECTION("Int") {
+        REQUIRE(fl::mconcat(std::vector{1, 2, 3, 4}) == 10);
+    }
+
+    SECTION("Strings") {
+        const std::vector<std::string> parts{"1", std::string(100, '2'), "3"};
+        const auto result = fl::mconcat(parts);
+
+        REQUIRE(result == "1" + std::string(100, '2') + "3");
+        REQUIRE(result.capacity() < 2 * result.size());
+        REQUIRE(parts[1].size() == 100);
+    }
+
+    SECTION("Vectors") {
+        using Vec = std::vector<std::string>;
+        std::vector<Vec> parts{{"1", "2"}, {}, {std::string(100, '3')}};
+        const auto result = fl::mconcat(parts);
+
+        REQUIRE(result == Vec{"1", "2", std::string(100, '3')});
+        REQUIRE(result.capacity() == 3);
+        REQUIRE(parts[2][0].size() == 100);
+    }
+
+    SECTION("Logs of an rvalue container are moved") {
+        using Vec = std::vector<std::string>;
+        std::vector<Vec> parts{{"1"}, {std::string(100, '2')}};
+        const auto *data = parts[1][0].data();
+        const auto result = fl::mconcat(std::move(parts));
+
+        REQUIRE(result == Vec{"1", std::string(100, '2')});
+        REQUIRE(result[1].data() == data);
+    }
+
+    SECTION("Views") {
+        const std::vector<std::string> parts{"1", "2", "3", "4"};
+
+        REQUIRE(fl::mconcat(parts | std::views::reverse) == "4321");
+        REQUIRE(fl::mconcat(std::views::transform(parts, [](const auto &p) { return p + p; })) == "11223344");
+        REQUIRE(parts[0] == "1");
+    }
+
+    SECTION("Sets") {
+        REQUIRE(fl::mconcat(std::list<std::set<int>>{{1, 2}, {2, 3}, {4}}) == std::set<int>{1, 2, 3, 4});
+    }
+}
@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <fl/writer/all.hpp>
+#include <fl/writer/lazy_operations.hpp>
+
+#include "writer_default_types.hpp"
+
+using NullLogger = fl::Writer<fl::NullLog, int>;
+
+namespace test_null_log {
+
+template <class W, class Entry>
+concept Tellable = requires(W w, Entry e) { w.tell(std::move(e)); };
+
+template <class W, class Entries>
+concept TellableAll = requires(W w, Entries e) { w.tell_all(std::move(e)); };
+
+} // namespace test_null_log
+
+static_assert(std::is_empty_v<fl::NullLog>);
+static_assert(sizeof(NullLogger) == sizeof(int));
+static_assert(sizeof(fl::Writer<fl::NullLog, std::string>) == sizeof(std::string));
+static_assert(fl::discards_entries_v<const fl::NullLog &>);
+static_assert(!fl::discards_entries_v<Log>);
+
+// Writers with disabled logging can be used in constant expressions
+static_assert(NullLogger{{}, 1}
+                  .tell("foo")
+                  .transform([](int v) { return v + 1; })
+                  .and_then([](int v) { return NullLogger{{"bar"}, v * 2}; })
+                  .tell_with([](int) { return "baz"; })
+                  .value() == 4);
+
+TEST_CASE("Null log") {
+    SECTION("Entries are ignored") {
+        const auto w = NullLogger{{"foo"}, 1}.tell(std::string("bar")).tell(Log{"baz"});
+
+        REQUIRE(w.log() == fl::NullLog{});
+        REQUIRE(w.value() == 1);
+        REQUIRE(w.tell_all(Log{"qux"}) == w);
+    }
+
+    SECTION("Entries for tell with are not created") {
+        int calls = 0;
+        const auto make = [&](int v) { ++calls; return std::to_string(v); };
+
+        const NullLogger w{{}, 1};
+        const auto r = w.tell_with(make).and_then([&](int v) { return NullLogger{{}, v + 1}.tell_with(make); });
+
+        REQUIRE(r.value() == 2);
+        REQUIRE(calls == 0);
+    }
+
+    SECTION("Semigroup and monoid") {
+        fl::Monoid<fl::NullLog> m;
+
+        REQUIRE(m.combine(m.identity(), fl::NullLog{}) == fl::NullLog{});
+        REQUIRE(NullLogger{{}, 1}.reset() == NullLogger{{}, 1});
+    }
+
+    SECTION("Other methods") {
+        const NullLogger w{{}, 2};
+
+        REQUIRE(w.apply(NullLogger{{}, 1}.transform([](int) { return [](int v) { return v * 3; }; })).value() == 6);
+        REQUIRE(w.swap() == fl::Writer<int, fl::NullLog>{2, {}});
+        REQUIRE(std::get<1>(w.as_tuple()) == 2);
+    }
+
+    SECTION("And then keeps logging switched off") {
+        const NullLogger w{{}, 2};
+        const auto f = [](int v) { return Logger{{"foo"}, Value(v) + 1}; };
+
+        const auto r1 = w.and_then(f);
+        const auto r2 = NullLogger{{}, 2}.and_then(f);
+        const auto r3 = std::move(w).and_then(f);
+
+        STATIC_REQUIRE(std::is_same_v<decltype(r1), const fl::Writer<fl::NullLog, Value>>);
+        STATIC_REQUIRE(std::is_same_v<decltype(r2), decltype(r1)>);
+        STATIC_REQUIRE(std::is_same_v<decltype(r3), decltype(r1)>);
+        REQUIRE(r1.value() == 3);
+        REQUIRE(r2.value() == 3);
+        REQUIRE(r3.value() == 3);
+    }
+
+    SECTION("Entries are checked") {
+        STATIC_REQUIRE(test_null_log::Tellable<NullLogger, std::string>);
+        STATIC_REQUIRE(test_null_log::Tellable<NullLogger, Log>);
+        STATIC_REQUIRE(!test_null_log::Tellable<NullLogger, void (*)()>);
+        STATIC_REQUIRE(!test_null_log::Tellable<NullLogger, decltype([] { return "foo"; })>);
+        STATIC_REQUIRE(test_null_log::TellableAll<NullLogger, Log>);
+        STATIC_REQUIRE(!test_null_log::TellableAll<NullLogger, int>);
+    }
+
+    SECTION("Lazy operations") {
+        using namespace fl;
+
+        const auto r = NullLogger{{}, 1}
+            | tell(std::string("foo"))
+            | transform([](int v) { return v + 1; })
+            | eval;
+
+        REQUIRE(r.value() == 2);
+    }
+}
+
+TEST_CASE("Tell with") {
+    SECTION("Entry is created from the value") {
+        const Logger w{{"foo"}, 42};
+
+        REQUIRE(w.tell_with([](Value v) { return std::to_string(v); }).log() == Log{"foo", "42"});
+        REQUIRE(Logger{{}, 1}.tell_with([](Value v) { return Log{std::to_string(v)}; }).log() == Log{"1"});
+        REQUIRE(w.log() == Log{"foo"});
+    }
+}
@@ -0,0 +1,211 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Map = fl::PersistentMap<std::string, int>;
+using Numbers = fl::PersistentMap<int, int>;
+
+// All keys collide
+struct ConstantHash {
+    std::size_t operator()(int) const noexcept { return 42; }
+};
+
+using Colliding = fl::PersistentMap<int, int, ConstantHash>;
+
+template <class M>
+std::map<typename M::key_type, typename M::mapped_type> entries(const M &m) {
+    std::map<typename M::key_type, typename M::mapped_type> result;
+    m.for_each([&](const auto &k, const auto &v) { result.emplace(k, v); });
+    return result;
+}
+
+[[nodiscard]]
+Numbers numbers(int from, int to, int offset = 0) {
+    Numbers result;
+    for (int i = from; i < to; ++i) {
+        result.set(i, i + offset);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Persistent map") {
+    SECTION("Set and find") {
+        Map m{{"foo", 1}, {"bar", 2}};
+        m.set("foo", 3);
+
+        REQUIRE(m.size() == 2);
+        REQUIRE(m.at("foo") == 3);
+        REQUIRE(m.at("bar") == 2);
+        REQUIRE(m.find("baz") == nullptr);
+        REQUIRE(!m.contains("baz"));
+        REQUIRE_THROWS_AS(m.at("baz"), std::out_of_range);
+        REQUIRE(Map().empty());
+    }
+
+    SECTION("Many keys") {
+        const auto m = numbers(0, 10'000);
+
+        REQUIRE(m.size() == 10'000);
+        for (int i = 0; i < 10'000; ++i) {
+            REQUIRE(m.at(i) == i);
+        }
+        REQUIRE(entries(m).size() == 10'000);
+    }
+
+    SECTION("Copies are independent") {
+        const auto base = numbers(0, 1'000);
+        auto copy = base;
+
+        REQUIRE(copy.shares_root_with(base));
+
+        copy.set(1, 100).set(5'000, 5'000);
+        copy.erase(2);
+
+        REQUIRE(!copy.shares_root_with(base));
+        REQUIRE(base == numbers(0, 1'000));
+        REQUIRE(copy.at(1) == 100);
+        REQUIRE(copy.at(5'000) == 5'000);
+        REQUIRE(!copy.contains(2));
+        REQUIRE(copy.size() == 1'000);
+    }
+
+    SECTION("Copies are used in other threads") {
+        auto base = numbers(0, 1'000);
+
+        std::vector<int> sums(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < sums.size(); ++i) {
+            threads.emplace_back([copy = base, &sum = sums[i]]() mutable {
+                copy.set(0, 1'000);
+                copy.for_each([&](int, int v) { sum += v; });
+            });
+        }
+        // Nodes become unique while the threads release their copies
+        for (int k = 0; k < 1'000; ++k) {
+            base.set(k, -k);
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+
+        REQUIRE(sums == std::vector<int>(4, 999 * 1'000 / 2 + 1'000));
+        REQUIRE(base.size() == 1'000);
+        REQUIRE(base.at(999) == -999);
+    }
+
+    SECTION("Erase") {
+        auto m = numbers(0, 1'000);
+        for (int i = 0; i < 1'000; i += 2) {
+            REQUIRE(m.erase(i) == 1);
+        }
+
+        REQUIRE(m.erase(0) == 0);
+        REQUIRE(m == [] {
+            Numbers odd;
+            for (int i = 1; i < 1'000; i += 2) {
+                odd.set(i, i);
+            }
+            return odd;
+        }());
+
+        for (int i = 1; i < 1'000; i += 2) {
+            m.erase(i);
+        }
+        REQUIRE(m.empty());
+    }
+
+    SECTION("Colliding keys") {
+        Colliding m;
+        m.set(1, 1).set(2, 2).set(3, 3).set(2, 20);
+
+        REQUIRE(m.size() == 3);
+        REQUIRE(m.at(2) == 20);
+
+        m.erase(1);
+        REQUIRE(entries(m) == std::map<int, int>{{2, 20}, {3, 3}});
+    }
+
+    SECTION("Merge") {
+        auto m = numbers(0, 1'000);
+        m.merge(numbers(500, 1'500, 1));
+
+        REQUIRE(m.size() == 1'500);
+        REQUIRE(m.at(0) == 0);
+        REQUIRE(m.at(499) == 499);
+        REQUIRE(m.at(500) == 501);
+        REQUIRE(m.at(1'499) == 1'500);
+    }
+
+    SECTION("Merge with a modified copy") {
+        const auto base = numbers(0, 10'000);
+        auto changed = base;
+        changed.set(1, -1).set(20'000, 0);
+
+        auto merged = base;
+        merged.merge(changed);
+
+        REQUIRE(merged == changed);
+        REQUIRE(base == numbers(0, 10'000));
+        REQUIRE(changed.size() == 10'001);
+    }
+
+    SECTION("Merge colliding keys") {
+        Colliding m;
+        m.set(1, 1).set(2, 2);
+        m.merge(Colliding{{2, 20}, {3, 3}});
+
+        REQUIRE(entries(m) == std::map<int, int>{{1, 1}, {2, 20}, {3, 3}});
+    }
+}
+
+TEST_CASE("Persistent map semigroup") {
+    fl::Monoid<Map> m;
+
+    SECTION("Values of the right map win") {
+        REQUIRE(m.combine(Map{{"foo", 1}, {"bar", 2}}, Map{{"foo", 3}}) == Map{{"foo", 3}, {"bar", 2}});
+        REQUIRE(m.combine(Map{{"foo", 3}}, Map{{"foo", 1}, {"bar", 2}}) == Map{{"foo", 1}, {"bar", 2}});
+    }
+
+    SECTION("Entries") {
+        REQUIRE(m.combine(Map{{"foo", 1}}, std::pair{"foo", 2}) == Map{{"foo", 2}});
+    }
+
+    SECTION("Identity shares the root") {
+        const Map foo{{"foo", 1}};
+
+        REQUIRE(m.combine(m.identity(), foo).shares_root_with(foo));
+        REQUIRE(m.combine(foo, m.identity()).shares_root_with(foo));
+    }
+}
+
+TEST_CASE("Writer with persistent map") {
+    using Logger = fl::Writer<Map, int>;
+
+    const auto base = Logger{{{"step", 0}}, 1};
+    const auto a = base.tell(std::pair{"step", 1}).tell(std::pair{"a", 1});
+    const auto b = base.and_then([](int v) { return Logger{{{"b", v}}, v + 1}; });
+
+    REQUIRE(base.log() == Map{{"step", 0}});
+    REQUIRE(a.log() == Map{{"step", 1}, {"a", 1}});
+    REQUIRE(b.log() == Map{{"step", 0}, {"b", 1}});
+    REQUIRE(b.value() == 2);
+}
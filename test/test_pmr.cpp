@@ -0,0 +1,145 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <memory_resource>
+#include <set>
+
+#include <fl/writer/all.hpp>
+
+using PmrLog = std::pmr::vector<std::pmr::string>;
+using PmrLogger = fl::Writer<PmrLog, int>;
+
+namespace {
+
+// Any allocation from the default memory resource throws
+struct NoDefaultResource {
+    NoDefaultResource() : previous(std::pmr::set_default_resource(std::pmr::null_memory_resource())) {}
+    ~NoDefaultResource() { std::pmr::set_default_resource(previous); }
+
+    std::pmr::memory_resource *previous;
+};
+
+const std::string long_string(100, 'x');
+const char *const long_entry = long_string.c_str();
+
+PmrLog makeLog(std::pmr::memory_resource *resource) {
+    PmrLog l(resource);
+    l.emplace_back(long_entry);
+    return l;
+}
+
+} // namespace
+
+TEST_CASE("Allocator-aware semigroups") {
+    std::pmr::monotonic_buffer_resource resource;
+    const NoDefaultResource guard;
+
+    SECTION("Vector") {
+        fl::Semigroup<PmrLog> sg;
+        const auto l1 = makeLog(&resource);
+        const auto l2 = makeLog(&resource);
+
+        const auto r1 = sg.combine(l1, l2);
+        const auto r2 = sg.combine(l1, long_entry);
+
+        REQUIRE(r1.get_allocator().resource() == &resource);
+        REQUIRE(r1.back().get_allocator().resource() == &resource);
+        REQUIRE(r2.get_allocator().resource() == &resource);
+        REQUIRE(r2.back() == long_entry);
+    }
+
+    SECTION("String") {
+        fl::Semigroup<std::pmr::string> sg;
+        const std::pmr::string s(long_entry, &resource);
+
+        const auto r = sg.combine(s, long_entry);
+
+        REQUIRE(r.get_allocator().resource() == &resource);
+        REQUIRE(std::string_view(r) == long_string + long_string);
+    }
+
+    SECTION("Set") {
+        fl::Semigroup<std::pmr::set<int>> sg;
+        const std::pmr::set<int> s({1, 2}, &resource);
+
+        const auto r = sg.combine(s, 3);
+
+        REQUIRE(r.get_allocator().resource() == &resource);
+        REQUIRE(r == std::pmr::set<int>({1, 2, 3}, &resource));
+    }
+
+    SECTION("Monoid") {
+        const auto l = fl::Monoid<PmrLog>().identity(std::pmr::polymorphic_allocator<>(&resource));
+
+        REQUIRE(l.empty());
+        REQUIRE(l.get_allocator().resource() == &resource);
+    }
+}
+
+TEST_CASE("Allocator-aware writer") {
+    std::pmr::monotonic_buffer_resource resource;
+    const NoDefaultResource guard;
+
+    const PmrLogger w{PmrLog(&resource), 1};
+    const auto inResource = [&](const PmrLog &l) {
+        return l.get_allocator().resource() == &resource &&
+            std::ranges::all_of(l, [&](const auto &s) { return s.get_allocator().resource() == &resource; });
+    };
+
+    SECTION("Tell") {
+        const auto r1 = w.tell(long_entry);
+        const auto r2 = PmrLogger{PmrLog(&resource), 1}.tell(long_entry).tell(r1.log_);
+
+        REQUIRE(inResource(r1.log_));
+        REQUIRE(inResource(r2.log_));
+        REQUIRE(r2.log_.size() == 2);
+    }
+
+    SECTION("And then") {
+        const auto r = w.tell(long_entry).and_then([&](int v) {
+            return PmrLogger{makeLog(&resource), v + 1};
+        });
+
+        REQUIRE(inResource(r.log_));
+        REQUIRE(r.log_.size() == 2);
+    }
+
+    SECTION("Copies") {
+        const auto r = w.tell(long_entry);
+
+        REQUIRE(inResource(r.transform([](int v) { return v + 1; }).log_));
+        REQUIRE(inResource(r.log()));
+        REQUIRE(inResource(std::get<0>(r.as_tuple())));
+        REQUIRE(inResource(r.swap().value_));
+    }
+
+    SECTION("Skipped entries") {
+        const auto r = w.tell(long_entry);
+        const auto make = [](int) { return long_entry; };
+
+        REQUIRE(inResource(r.tell_if([] { return false; }, make).log_));
+        REQUIRE(inResource(std::move(r).tell_if([] { return false; }, make).log_));
+
+        using LeveledLog = std::pmr::vector<fl::Leveled<std::pmr::string>>;
+        const fl::Writer<LeveledLog, int> lw{LeveledLog(&resource), 1};
+        const auto skipped = fl::tell_at<fl::Level::Debug>(lw, fl::filters::StaticThreshold<fl::Level::Info>{}, make);
+
+        REQUIRE(skipped.log_.get_allocator().resource() == &resource);
+    }
+
+    SECTION("Reset") {
+        const auto r = w.tell(long_entry).reset();
+
+        REQUIRE(r.log_.empty());
+        REQUIRE(r.log_.get_allocator().resource() == &resource);
+    }
+}
@@ -0,0 +1,105 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+namespace test_product_semigroup {
+
+using Text = std::vector<std::string>;
+
+struct Channels {
+    Text text;
+    std::uint64_t requests = 0;
+    std::string trace;
+
+    bool operator==(const Channels &) const = default;
+};
+
+} // namespace test_product_semigroup
+
+template <>
+struct fl::product_members<test_product_semigroup::Channels> {
+    using Channels = test_product_semigroup::Channels;
+    static constexpr auto value = std::tuple{&Channels::text, &Channels::requests, &Channels::trace};
+};
+
+TEST_CASE("Product semigroup") {
+    using namespace test_product_semigroup;
+
+    SECTION("Tuple") {
+        using Log = std::tuple<Text, std::uint64_t, std::string>;
+        fl::Semigroup<Log> sg;
+
+        REQUIRE(sg.combine(Log{{"foo"}, 1, "a"}, Log{{"bar"}, 2, "b"}) == Log{{"foo", "bar"}, 3, "ab"});
+    }
+
+    SECTION("Pair") {
+        using Log = std::pair<Text, int>;
+        fl::Semigroup<Log> sg;
+        const Log foo{{"foo"}, 1};
+
+        REQUIRE(sg.combine(foo, foo) == Log{{"foo", "foo"}, 2});
+        REQUIRE(foo == Log{{"foo"}, 1});
+    }
+
+    SECTION("Aggregate") {
+        fl::Semigroup<Channels> sg;
+
+        REQUIRE(sg.combine(Channels{{"foo"}, 1, "a"}, Channels{{"bar"}, 2, "b"}) == Channels{{"foo", "bar"}, 3, "ab"});
+    }
+
+    SECTION("Rvalue fields are moved through") {
+        using Log = std::tuple<Text, std::string>;
+        Log acc{{"foo"}, std::string(100, 'x')};
+        Log v{{std::string(100, 'z')}, std::string(100, 'y')};
+        const auto *text = std::get<0>(v).front().data();
+
+        fl::Semigroup<Log>().combine_into(acc, std::move(v));
+
+        REQUIRE(std::get<0>(acc).back().data() == text);
+        REQUIRE(std::get<1>(acc) == std::string(100, 'x') + std::string(100, 'y'));
+    }
+
+    SECTION("Channels") {
+        using Log = std::tuple<Text, std::uint64_t>;
+        fl::Semigroup<Log> sg;
+
+        REQUIRE(sg.combine(Log{{"foo"}, 1}, fl::channel<0>(std::string("bar"))) == Log{{"foo", "bar"}, 1});
+        REQUIRE(sg.combine(Log{{"foo"}, 1}, fl::channel<1>(std::uint64_t(2))) == Log{{"foo"}, 3});
+        REQUIRE(sg.combine(Log{{"foo"}, 1}, fl::channel<0>(Text{"bar", "baz"})) == Log{{"foo", "bar", "baz"}, 1});
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<Channels> m;
+
+        REQUIRE(m.identity() == Channels{});
+        REQUIRE(m.combine(m.identity(), Channels{{"foo"}, 1, "a"}) == Channels{{"foo"}, 1, "a"});
+    }
+}
+
+TEST_CASE("Writer with several log channels") {
+    using namespace test_product_semigroup;
+    using Logger = fl::Writer<Channels, int>;
+
+    const auto w = Logger{{}, 1}
+        .tell(fl::channel<0>(std::string("Started")))
+        .and_then([](int v) { return Logger{{{"Incremented"}, 1, "+"}, v + 1}; })
+        .tell(fl::channel<1>(std::uint64_t(1)))
+        .tell(fl::channel<2>(std::string("!")));
+
+    REQUIRE(w.value() == 2);
+    REQUIRE(w.log() == Channels{{"Started", "Incremented"}, 2, "+!"});
+}
@@ -0,0 +1,156 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <sstream>
+
+#include <fl/semigroups/semigroup_rope.hpp>
+#include <fl/monoids/all.hpp>
+#include <fl/writer/writer.hpp>
+
+TEST_CASE("Rope") {
+    SECTION("Append pieces") {
+        fl::Rope r;
+        r.append("foo").append(std::string_view("bar")).append(std::string("baz"));
+
+        REQUIRE(r.size() == 9);
+        REQUIRE(r == "foobarbaz");
+        REQUIRE(r.str() == "foobarbaz");
+    }
+
+    SECTION("Short pieces share a chunk") {
+        fl::Rope r;
+        for (int i = 0; i < 100; ++i) {
+            r.append("0123456789");
+        }
+
+        REQUIRE(r.chunks_count() <= 2);
+        REQUIRE(r.size() == 1000);
+    }
+
+    SECTION("Long rvalue strings are adopted") {
+        std::string big(fl::Rope::chunk_size * 2, 'x');
+        const auto *data = big.data();
+
+        fl::Rope r("foo");
+        r.append(std::move(big));
+
+        std::vector<const char *> chunks;
+        r.for_each_chunk([&](std::string_view c) { chunks.push_back(c.data()); });
+
+        REQUIRE(chunks.size() == 2);
+        REQUIRE(chunks.back() == data);
+    }
+
+    SECTION("Flatten") {
+        fl::Rope r("foo");
+        r.append(std::string(fl::Rope::chunk_size * 2, 'x'));
+        r.append("bar");
+
+        const auto expected = "foo" + std::string(fl::Rope::chunk_size * 2, 'x') + "bar";
+
+        REQUIRE(r.chunks_count() > 1);
+        REQUIRE(r.flatten() == expected);
+        REQUIRE(r.chunks_count() == 1);
+        REQUIRE(r == expected);
+    }
+
+    SECTION("Compare ropes with different chunks") {
+        fl::Rope r1("foo");
+        r1.append(std::string(fl::Rope::chunk_size, 'x'));
+
+        fl::Rope r2(std::string(3 + fl::Rope::chunk_size / 2, 'x'));
+        r2.append(std::string(fl::Rope::chunk_size / 2, 'x'));
+
+        fl::Rope r3("foo" + std::string(fl::Rope::chunk_size, 'x'));
+
+        REQUIRE(r1 != r2);
+        REQUIRE(r1 == r3);
+        REQUIRE(r3 == r1);
+    }
+
+    SECTION("Append to itself") {
+        const auto text = "foo" + std::string(fl::Rope::chunk_size, 'x');
+
+        fl::Rope r1(text);
+        r1.append(r1);
+        REQUIRE(r1 == text + text);
+
+        fl::Rope r2(text);
+        r2.append(std::move(r2));
+        REQUIRE(r2 == text + text);
+
+        fl::Rope r3;
+        r3.append(std::move(r3));
+        REQUIRE(r3.empty());
+    }
+
+    SECTION("Write to stream") {
+        fl::Rope r("foo");
+        r.append(std::string(fl::Rope::chunk_size, 'x'));
+
+        std::ostringstream os;
+        os << r;
+
+        REQUIRE(os.str() == r.str());
+    }
+}
+
+TEST_CASE("Rope semigroup") {
+    fl::Semigroup<fl::Rope> sg;
+
+    SECTION("Combine ropes") {
+        REQUIRE(sg.combine(fl::Rope("foo"), fl::Rope("bar")) == "foobar");
+
+        const fl::Rope foo("foo");
+        const fl::Rope bar("bar");
+        REQUIRE(sg.combine(foo, bar) == "foobar");
+        REQUIRE(foo == "foo");
+    }
+
+    SECTION("Combine with strings") {
+        REQUIRE(sg.combine(fl::Rope("foo"), "bar") == "foobar");
+        REQUIRE(sg.combine(fl::Rope("foo"), std::string("bar")) == "foobar");
+        REQUIRE(sg.combine(fl::Rope("foo"), std::string_view("bar")) == "foobar");
+    }
+
+    SECTION("Associativity") {
+        REQUIRE(sg.combine(fl::Rope("baz"), sg.combine(fl::Rope("foo"), fl::Rope("bar"))) ==
+                sg.combine(sg.combine(fl::Rope("baz"), fl::Rope("foo")), fl::Rope("bar")));
+    }
+
+    SECTION("Identity") {
+        fl::Monoid<fl::Rope> m;
+
+        REQUIRE(m.identity().empty());
+        REQUIRE(m.combine(m.identity(), fl::Rope("foo")) == "foo");
+        REQUIRE(m.combine(fl::Rope("foo"), m.identity()) == "foo");
+    }
+}
+
+TEST_CASE("Writer with rope") {
+    using RopeLogger = fl::Writer<fl::Rope, int>;
+
+    SECTION("Tell") {
+        REQUIRE(RopeLogger{"foo", 1}.tell("bar").tell(std::string("baz")).log() == "foobarbaz");
+    }
+
+    SECTION("And then") {
+        const auto w = RopeLogger{"foo", 1}.and_then([](int v) { return RopeLogger{"bar", v + 1}; });
+
+        REQUIRE(w.log() == "foobar");
+        REQUIRE(w.value() == 2);
+    }
+
+    SECTION("Reset") {
+        REQUIRE(RopeLogger{"foo", 1}.reset().log().empty());
+    }
+}
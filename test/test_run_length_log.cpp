@@ -0,0 +1,128 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fl/semigroups/semigroup_run_length_log.hpp>
+#include <fl/monoids/all.hpp>
+#include <fl/writer/writer.hpp>
+
+using Consecutive = fl::RunLengthLog<std::string>;
+using Global = fl::RunLengthLog<std::string, fl::dedup::Global>;
+using Runs = std::vector<fl::Run<std::string>>;
+
+TEST_CASE("Run-length log") {
+    SECTION("Consecutive duplicates are collapsed") {
+        Consecutive l;
+        l.add("foo").add("foo").add(std::string("bar")).add("foo", 2);
+
+        REQUIRE(l.runs() == Runs{{"foo", 2}, {"bar", 1}, {"foo", 2}});
+        REQUIRE(l.size() == 3);
+        REQUIRE(l.entries_count() == 5);
+    }
+
+    SECTION("All duplicates are collapsed in global mode") {
+        Global l;
+        l.add("foo").add("bar").add("foo").add("baz", 3).add("bar");
+
+        REQUIRE(l.runs() == Runs{{"foo", 2}, {"bar", 2}, {"baz", 3}});
+        REQUIRE(l.entries_count() == 7);
+    }
+
+    SECTION("Many distinct entries in global mode") {
+        Global l;
+        for (int i = 0; i < 100; ++i) {
+            l.add(std::to_string(i % 20));
+        }
+
+        REQUIRE(l.size() == 20);
+        REQUIRE(l.entries_count() == 100);
+        REQUIRE(std::all_of(l.begin(), l.end(), [](const auto &run) { return run.count == 5; }));
+        REQUIRE(l.runs().back().entry == "19");
+    }
+
+    SECTION("Zero repetitions are ignored") {
+        Consecutive l{"foo"};
+        l.add("bar", 0);
+
+        REQUIRE(l == Consecutive{"foo"});
+    }
+
+    SECTION("Append") {
+        Consecutive l{"foo", "bar"};
+        l.append(Consecutive{"bar", "baz"});
+        l.append(l);
+
+        REQUIRE(l.runs() == Runs{{"foo", 1}, {"bar", 2}, {"baz", 1}, {"foo", 1}, {"bar", 2}, {"baz", 1}});
+        REQUIRE(l.entries_count() == 8);
+    }
+
+    SECTION("Append to itself") {
+        Consecutive l1{"foo", "bar", "baz"};
+        l1.append(l1);
+        REQUIRE(l1.runs() == Runs{{"foo", 1}, {"bar", 1}, {"baz", 1}, {"foo", 1}, {"bar", 1}, {"baz", 1}});
+
+        Consecutive l2{"foo", "bar", "baz"};
+        l2.append(std::move(l2));
+        REQUIRE(l2.runs() == Runs{{"foo", 1}, {"bar", 1}, {"baz", 1}, {"foo", 1}, {"bar", 1}, {"baz", 1}});
+        REQUIRE(l2.entries_count() == 6);
+
+        Global l3{"foo", "bar"};
+        l3.append(std::move(l3));
+        REQUIRE(l3.runs() == Runs{{"foo", 2}, {"bar", 2}});
+    }
+
+    SECTION("Append in global mode") {
+        Global l{"foo", "bar"};
+        const Global other{"baz", "foo"};
+        l.append(other);
+        l.append(l);
+
+        REQUIRE(l.runs() == Runs{{"foo", 4}, {"bar", 2}, {"baz", 2}});
+        REQUIRE(other.runs() == Runs{{"baz", 1}, {"foo", 1}});
+    }
+}
+
+TEST_CASE("Run-length log semigroup") {
+    SECTION("Combine") {
+        fl::Semigroup<Consecutive> sg;
+        const Consecutive foo{"foo"};
+
+        REQUIRE(sg.combine(foo, foo).runs() == Runs{{"foo", 2}});
+        REQUIRE(sg.combine(foo, "bar").runs() == Runs{{"foo", 1}, {"bar", 1}});
+        REQUIRE(sg.combine(Consecutive{"bar"}, foo).runs() == Runs{{"bar", 1}, {"foo", 1}});
+    }
+
+    SECTION("Associativity") {
+        fl::Semigroup<Global> sg;
+
+        REQUIRE(sg.combine(Global{"foo"}, sg.combine(Global{"bar"}, Global{"foo"})) ==
+                sg.combine(sg.combine(Global{"foo"}, Global{"bar"}), Global{"foo"}));
+    }
+}
+
+TEST_CASE("Writer with run-length log") {
+    using Logger = fl::Writer<Consecutive, int>;
+
+    Logger w{{}, 0};
+    for (int i = 0; i < 1'000; ++i) {
+        w = std::move(w)
+            .transform([](int v) { return v + 1; })
+            .and_then([](int v) { return Logger{{"Incremented"}, v}; });
+    }
+    w = std::move(w).tell("Done");
+
+    REQUIRE(w.value() == 1'000);
+    REQUIRE(w.log().runs() == Runs{{"Incremented", 1'000}, {"Done", 1}});
+}
@@ -12,6 +12,9 @@
 
 #include <fl/semigroups/all.hpp>
 
+#include <set>
+#include <string>
+#include <string_view>
 #include <vector>
 
 
@@ -129,4 +132,56 @@ TEST_CASE("Combine") {
         REQUIRE(s.combine(std::set<int>{1, 2, 3}, 4) == std::set<int>{1, 2, 3, 4});
         REQUIRE(s.combine(std::set<int>{1, 2, 4}, 3) == std::set<int>{1, 2, 3, 4});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Combine several") {
+    SECTION("Strings") {
+        fl::Semigroup<std::string> s;
+
+        const std::string first = "1";
+        REQUIRE(s.combine(first, std::string_view("2"), "3") == "123");
+        REQUIRE(s.combine("1", std::string("2"), std::string_view("3"), "4") == "1234");
+        REQUIRE(first == "1");
+    }
+
+    SECTION("Strings allocate once") {
+        fl::Semigroup<std::string> s;
+
+        const std::string part(100, 'a');
+        const auto result = s.combine(part, part, part, part);
+
+        REQUIRE(result == std::string(400, 'a'));
+        REQUIRE(result.capacity() < 2 * result.size());
+    }
+
+    SECTION("Moved first string") {
+        fl::Semigroup<std::string> s;
+
+        std::string first(100, 'a');
+        first.reserve(1000);
+        const auto *data = first.data();
+        const auto result = s.combine(std::move(first), std::string(100, 'b'), "c");
+
+        REQUIRE(result == std::string(100, 'a') + std::string(100, 'b') + "c");
+        REQUIRE(result.data() == data);
+    }
+
+    SECTION("Vectors") {
+        fl::Semigroup<std::vector<std::string>> s;
+
+        const std::vector<std::string> v1{"1", "2"};
+        std::vector<std::string> v3{"5", std::string(100, '6')};
+        const auto result = s.combine(v1, std::vector<std::string>{"3", "4"}, std::move(v3), v1);
+
+        REQUIRE(result == std::vector<std::string>{"1", "2", "3", "4", "5", std::string(100, '6'), "1", "2"});
+        REQUIRE(result.capacity() == result.size());
+        REQUIRE(v1.size() == 2);
+    }
+
+    SECTION("Sets") {
+        fl::Semigroup<std::set<int>> s;
+
+        const std::set<int> s1{1, 2};
+        REQUIRE(s.combine(s1, std::set<int>{2, 3}, std::set<int>{4}) == std::set<int>{1, 2, 3, 4});
+    }
+}
@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <fl/writer/all.hpp>
+
+#include "writer_default_types.hpp"
+
+namespace test_shared_log {
+
+struct Counted {
+    static inline std::size_t copies = 0;
+
+    Counted(const char *s) : value(s) {} // NOLINT
+    Counted(const Counted &other) : value(other.value) { ++copies; }
+    Counted(Counted &&) noexcept = default;
+    Counted &operator=(const Counted &other) { value = other.value; ++copies; return *this; }
+    Counted &operator=(Counted &&) noexcept = default;
+
+    bool operator==(const Counted &) const = default;
+
+    std::string value;
+};
+
+template <class L, class V>
+concept Appendable = requires(L l, V v) { l.append(std::move(v)); };
+
+template <class L, class V>
+concept Combinable = requires(fl::Semigroup<L> s, L l, V v) {
+    s.combine(l, v);
+    s.combine_into(l, std::move(v));
+};
+
+} // namespace test_shared_log
+
+TEST_CASE("Shared log") {
+    using Shared = fl::SharedLog<Log>;
+
+    SECTION("Append entries") {
+        Shared l;
+        l.append("foo").append(std::string("bar"));
+
+        REQUIRE(l.flatten() == Log{"foo", "bar"});
+    }
+
+    SECTION("Copies share the log") {
+        Shared l(Log{"foo"});
+        const auto copy = l;
+
+        REQUIRE(!l.unique());
+        REQUIRE(!copy.unique());
+
+        l.append("bar");
+
+        REQUIRE(copy.flatten() == Log{"foo"});
+        REQUIRE(l.flatten() == Log{"foo", "bar"});
+        REQUIRE(l.unique());
+    }
+
+    SECTION("Branches do not affect each other") {
+        const Shared base(Log{"base"});
+
+        auto b1 = Shared(base).append("b1");
+        auto b2 = Shared(base).append("b2").append("b2-1");
+
+        REQUIRE(base.flatten() == Log{"base"});
+        REQUIRE(b1.flatten() == Log{"base", "b1"});
+        REQUIRE(b2.flatten() == Log{"base", "b2", "b2-1"});
+    }
+
+    SECTION("Append shared logs") {
+        const Shared foo(Log{"foo"});
+        Shared bar(Log{"bar"});
+
+        auto l = Shared(foo).append(bar).append(Shared(Log{"baz"}));
+
+        REQUIRE(l.flatten() == Log{"foo", "bar", "baz"});
+        REQUIRE(foo.flatten() == Log{"foo"});
+        REQUIRE(bar.flatten() == Log{"bar"});
+    }
+
+    SECTION("Segments in order") {
+        const Shared base(Log{"1", "2"});
+        auto l = Shared(base).append(Shared(Log{"3"})).append("4");
+
+        Log segments;
+        l.for_each_segment([&](const Log &s) { segments.insert(segments.end(), s.begin(), s.end()); });
+
+        REQUIRE(segments == Log{"1", "2", "3", "4"});
+    }
+
+    SECTION("Deep tree") {
+        Shared l;
+        for (int i = 0; i < 100'000; ++i) {
+            const auto copy = l;
+            l = Shared(copy).append(Shared(Log{"foo"}));
+        }
+
+        std::size_t size = 0;
+        l.for_each_segment([&](const Log &s) { size += s.size(); });
+
+        REQUIRE(size == 100'000);
+    }
+
+    SECTION("Copies are used in other threads") {
+        Shared base(Log{"base"});
+
+        std::vector<std::size_t> sizes(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            threads.emplace_back([copy = base, &size = sizes[i]]() mutable {
+                copy.append("thread");
+                size = copy.flatten().size();
+            });
+        }
+        // The segment becomes unique while the threads release their copies
+        for (int k = 0; k < 1'000; ++k) {
+            base.append("main");
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+
+        REQUIRE(sizes == std::vector<std::size_t>(4, 2));
+        REQUIRE(base.flatten().size() == 1'001);
+        REQUIRE(base.unique());
+    }
+
+    SECTION("Equality") {
+        REQUIRE(Shared(Log{"foo"}).append("bar") == Shared(Log{"foo", "bar"}));
+        REQUIRE(Shared(Log{"foo"}) != Shared(Log{"bar"}));
+    }
+
+    SECTION("Only valid entries can be appended") {
+        using test_shared_log::Appendable;
+        using test_shared_log::Combinable;
+
+        STATIC_REQUIRE(Appendable<Shared, Log>);
+        STATIC_REQUIRE(Appendable<Shared, const char *>);
+        STATIC_REQUIRE(Combinable<Shared, Shared>);
+        STATIC_REQUIRE(!Appendable<Shared, int>);
+        STATIC_REQUIRE(!Combinable<Shared, int>);
+    }
+}
+
+TEST_CASE("Writer with shared log") {
+    using test_shared_log::Counted;
+    using CountedLog = std::vector<Counted>;
+    using SharedLogger = fl::Writer<fl::SharedLog<CountedLog>, Value>;
+
+    SECTION("Tell") {
+        REQUIRE(SharedLogger{}.tell("foo").tell("bar").log() == CountedLog{"foo", "bar"});
+    }
+
+    SECTION("And then") {
+        const auto w = SharedLogger{CountedLog{"foo"}, 1}
+            .and_then([](Value v) { return SharedLogger{CountedLog{"bar"}, v + 1}; });
+
+        REQUIRE(w.log() == CountedLog{"foo", "bar"});
+        REQUIRE(w.value() == 2);
+    }
+
+    SECTION("Const operations do not copy entries") {
+        const auto base = SharedLogger{CountedLog{"foo", "bar", "baz"}, 1};
+
+        Counted::copies = 0;
+
+        const auto b1 = base.tell("b1");
+        const auto b2 = base.and_then([](Value v) { return SharedLogger{{}, v}.tell("b2"); });
+        const auto b3 = base.transform([](Value v) { return v + 1; });
+        const auto [l, v] = base.as_tuple();
+        const auto s = base.swap();
+        const auto copy = base.log();
+
+        REQUIRE(Counted::copies == 0);
+
+        REQUIRE(b1.log() == CountedLog{"foo", "bar", "baz", "b1"});
+        REQUIRE(b2.log() == CountedLog{"foo", "bar", "baz", "b2"});
+        REQUIRE(base.log() == CountedLog{"foo", "bar", "baz"});
+    }
+}
@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <cmath>
+#include <string>
+
+#include <fl/writer/all.hpp>
+
+namespace {
+
+using Distinct = fl::HyperLogLog<std::uint64_t>;
+using Frequencies = fl::CountMinSketch<std::string, 256>;
+using Digest = fl::TDigest<>;
+
+[[nodiscard]]
+Distinct distinct(std::uint64_t from, std::uint64_t to) {
+    Distinct result;
+    for (auto v = from; v < to; ++v) {
+        result.add(v);
+    }
+    return result;
+}
+
+[[nodiscard]]
+Digest uniform(int from, int to) {
+    Digest result;
+    for (int v = from; v < to; ++v) {
+        result.add(v);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("HyperLogLog") {
+    SECTION("Empty") {
+        REQUIRE(Distinct().estimate() == 0.0);
+        REQUIRE(Distinct().registers().empty());
+    }
+
+    SECTION("Duplicates are not counted") {
+        Distinct d;
+        for (int i = 0; i < 1000; ++i) {
+            d.add(std::uint64_t(i % 10));
+        }
+
+        REQUIRE(std::round(d.estimate()) == 10.0);
+    }
+
+    SECTION("Estimate") {
+        const auto d = distinct(0, 100'000);
+
+        REQUIRE(d.registers().size() == Distinct::register_count);
+        REQUIRE(std::abs(d.estimate() - 100'000) < 100'000 * 0.05);
+    }
+
+    SECTION("Merge is the same as adding all entries") {
+        fl::Monoid<Distinct> m;
+        const auto merged = m.combine(distinct(0, 60'000), distinct(40'000, 100'000));
+
+        REQUIRE(merged == distinct(0, 100'000));
+        REQUIRE(m.combine(m.identity(), merged) == merged);
+        REQUIRE(m.combine(merged, m.identity()) == merged);
+
+        auto self = merged;
+        REQUIRE(self.merge(self) == merged);
+    }
+
+    SECTION("Strings") {
+        fl::HyperLogLog<std::string> d;
+        d.add("foo").add("bar").add(std::string("foo"));
+
+        REQUIRE(std::round(d.estimate()) == 2.0);
+    }
+}
+
+TEST_CASE("Count-min sketch") {
+    SECTION("Estimates are never less than counts") {
+        Frequencies f;
+        for (int i = 0; i < 1000; ++i) {
+            f.add(std::to_string(i % 100), i % 100 == 0 ? 100 : 1);
+        }
+
+        REQUIRE(f.total() == 1000 - 10 + 10 * 100);
+        REQUIRE(f.estimate(std::string("0")) >= 1000);
+        for (int i = 1; i < 100; ++i) {
+            REQUIRE(f.estimate(std::to_string(i)) >= 10);
+        }
+        REQUIRE(f.estimate(std::string("not added")) <= f.total());
+    }
+
+    SECTION("Small streams are exact") {
+        Frequencies f;
+        f.add("foo").add("foo").add("bar");
+
+        REQUIRE(f.estimate("foo") == 2);
+        REQUIRE(f.estimate("bar") == 1);
+        REQUIRE(f.estimate("baz") == 0);
+        REQUIRE(Frequencies().estimate("foo") == 0);
+    }
+
+    SECTION("Merge") {
+        fl::Monoid<Frequencies> m;
+        const auto merged = m.combine(Frequencies().add("foo"), Frequencies().add("foo", 2).add("bar"));
+
+        REQUIRE(merged == Frequencies().add("foo", 3).add("bar"));
+        REQUIRE(m.combine(m.identity(), merged) == merged);
+        REQUIRE(m.combine(merged, m.identity()) == merged);
+
+        auto self = merged;
+        REQUIRE(self.merge(self) == Frequencies().add("foo", 6).add("bar", 2));
+    }
+}
+
+TEST_CASE("t-digest") {
+    SECTION("Empty") {
+        REQUIRE(std::isnan(Digest().quantile(0.5)));
+    }
+
+    SECTION("Single sample") {
+        REQUIRE(Digest().add(42).quantile(0.1) == 42);
+    }
+
+    SECTION("Quantiles") {
+        const auto d = uniform(0, 10'000);
+
+        REQUIRE(d.total() == 10'000);
+        REQUIRE(d.quantile(0.0) == 0);
+        REQUIRE(d.quantile(1.0) == 9'999);
+        REQUIRE(std::abs(d.quantile(0.5) - 5'000) < 100);
+        REQUIRE(std::abs(d.quantile(0.99) - 9'900) < 20);
+        REQUIRE(std::abs(d.quantile(0.999) - 9'990) < 5);
+    }
+
+    SECTION("Size is bounded") {
+        auto d = uniform(0, 100'000);
+        d.compress();
+
+        REQUIRE(d.centroids().size() <= 2 * Digest::compression);
+    }
+
+    SECTION("Merge") {
+        fl::Monoid<Digest> m;
+        auto merged = m.identity();
+        for (int part = 0; part < 10; ++part) {
+            fl::combine_into(m, merged, uniform(part * 1'000, (part + 1) * 1'000));
+        }
+
+        REQUIRE(merged.total() == 10'000);
+        REQUIRE(merged.min() == 0);
+        REQUIRE(merged.max() == 9'999);
+        REQUIRE(std::abs(merged.quantile(0.5) - 5'000) < 100);
+        REQUIRE(std::abs(merged.quantile(0.99) - 9'900) < 20);
+    }
+
+    SECTION("Merge with itself") {
+        auto d = uniform(0, 1'000);
+
+        d.merge(d);
+        REQUIRE(d.total() == 2'000);
+
+        d.merge(std::move(d));
+        REQUIRE(d.total() == 4'000);
+        REQUIRE(d.min() == 0);
+        REQUIRE(d.max() == 999);
+        REQUIRE(std::abs(d.quantile(0.5) - 500) < 10);
+    }
+}
+
+TEST_CASE("Writer with sketches") {
+    using Logger = fl::Writer<std::tuple<Distinct, Digest>, int>;
+
+    const auto w = Logger{{}, 1}
+        .tell(fl::channel<0>(std::uint64_t(42)))
+        .tell(fl::channel<1>(10.0))
+        .and_then([](int v) { return Logger{{Distinct().add(std::uint64_t(42)), Digest().add(20)}, v + 1}; });
+
+    const auto [users, durations] = w.log();
+    REQUIRE(w.value() == 2);
+    REQUIRE(std::round(users.estimate()) == 1.0);
+    REQUIRE(durations.total() == 2);
+    REQUIRE(durations.quantile(0.0) == 10.0);
+}
@@ -0,0 +1,125 @@
+//
+// MIT License
+//
+// Copyright (c) 2026-present Vitaly Fanaskov
+//
+// fl -- Functional tools for C++
+// Project home: https://github.com/vt4a2h/fl
+//
+// See LICENSE file for the further details.
+//
+#include "catch.hpp"
+
+#include <fl/writer/all.hpp>
+#include <fl/fmt/tell_format.hpp>
+
+using Buffer = fmt::memory_buffer;
+using BufferLogger = fl::Writer<Buffer, int>;
+using StringLogger = fl::Writer<std::string, int>;
+
+TEST_CASE("Memory buffer semigroup") {
+    fl::Semigroup<Buffer> sg;
+
+    SECTION("Combine buffers") {
+        Buffer b1;
+        b1.append(std::string_view("foo"));
+        Buffer b2;
+        b2.append(std::string_view("bar"));
+
+        const auto r = sg.combine(b1, b2);
+
+        REQUIRE(fmt::to_string(r) == "foobar");
+        REQUIRE(fmt::to_string(b1) == "foo");
+        REQUIRE(fmt::to_string(sg.combine(std::move(b1), b2)) == "foobar");
+    }
+
+    SECTION("Combine buffers of different sizes") {
+        fmt::basic_memory_buffer<char, 16> small;
+        small.append(std::string_view("bar"));
+
+        REQUIRE(fmt::to_string(sg.combine(Buffer{}, small)) == "bar");
+        STATIC_REQUIRE(!fl::_concepts::AppendableToMemoryBuffer<fmt::basic_memory_buffer<wchar_t>, char>);
+    }
+
+    SECTION("Combine with strings") {
+        auto r = sg.combine(Buffer{}, "foo");
+        r = sg.combine(std::move(r), std::string("bar"));
+        r = sg.combine(std::move(r), std::string_view("baz"));
+
+        REQUIRE(fmt::to_string(r) == "foobarbaz");
+    }
+
+    SECTION("Combine into") {
+        Buffer b;
+        fl::combine_into(sg, b, "foo");
+        fl::combine_into(sg, b, std::string("bar"));
+
+        REQUIRE(fmt::to_string(b) == "foobar");
+    }
+
+    SECTION("Identity") {
+        REQUIRE(fl::Monoid<Buffer>().identity().size() == 0);
+    }
+}
+
+TEST_CASE("Tell format") {
+    SECTION("Memory buffer") {
+        const auto w = fl::tell_format(fl::tell_format(BufferLogger{Buffer(), 0}, "{} + {}", 1, 2), " = {}", 3);
+
+        REQUIRE(fmt::to_string(w.log_) == "1 + 2 = 3");
+    }
+
+    SECTION("Short logs are stored inline") {
+        auto w = BufferLogger{Buffer(), 0};
+        const auto *data = w.log_.data();
+
+        w = fl::tell_format(std::move(w), "Value is {}", 42);
+
+        REQUIRE(w.log_.data() == data);
+        REQUIRE(fmt::to_string(w.log_) == "Value is 42");
+    }
+
+    SECTION("String") {
+        const StringLogger w{"foo ", 1};
+
+        REQUIRE(fl::tell_format(w, "{}", "bar").log() == "foo bar");
+        REQUIRE(w.log() == "foo ");
+    }
+
+    SECTION("Rvalue writers are formatted in place") {
+        std::string l;
+        l.reserve(100);
+        const auto *data = l.data();
+
+        const auto w = fl::tell_format(StringLogger{std::move(l), 1}, "{}-{}", 'a', 'b');
+
+        REQUIRE(w.log_.data() == data);
+        REQUIRE(w.log() == "a-b");
+    }
+
+    SECTION("Lvalue writers are copied") {
+        BufferLogger w{Buffer(), 0};
+        w = fl::tell_format(std::move(w), "foo");
+
+        const auto r = fl::tell_format(w, "bar");
+
+        REQUIRE(fmt::to_string(r.log_) == "foobar");
+        REQUIRE(fmt::to_string(w.log_) == "foo");
+    }
+
+    SECTION("And then") {
+        const auto w = BufferLogger{Buffer(), 0}.and_then([](int) {
+            return fl::tell_format(BufferLogger{Buffer(), 1}, "foo");
+        });
+
+        REQUIRE(fmt::to_string(w.log_) == "foo");
+        REQUIRE(w.value() == 1);
+    }
+
+    SECTION("Other writers") {
+        static_assert(fl::concepts::WriterWithFormatTarget<StringLogger>);
+        static_assert(fl::concepts::WriterWithFormatTarget<const BufferLogger &>);
+        static_assert(!fl::concepts::WriterWithFormatTarget<fl::Writer<std::vector<std::string>, int>>);
+        static_assert(!fl::concepts::WriterWithFormatTarget<fl::Writer<std::wstring, int>>);
+    }
+}
@@ -12,6 +12,10 @@
 #include <fl/semigroups/any_semigroup.hpp>
 #include <fl/writer/writer.hpp>
 
+#include <list>
+#include <span>
+#include <vector>
+
 #include "catch.hpp"
 
 namespace test_any_semigroup {
@@ -48,6 +52,42 @@ struct SemigroupString {
     }
 };
 
+// Joins strings with a separator, too big to be stored inline
+struct Joining {
+    using ValueType = std::string;
+
+    std::string separator;
+
+    [[nodiscard]]
+    ValueType combine(const ValueType& v1, const ValueType& v2) const {
+        return v1.empty() ? v2 : v1 + separator + v2;
+    }
+
+    void combine_into(ValueType& acc, const ValueType& v) const {
+        if (!acc.empty()) {
+            acc.append(separator);
+        }
+        acc.append(v);
+    }
+};
+
+// Counts calls of combine_many
+struct Batching {
+    using ValueType = std::string;
+
+    int *batches = nullptr;
+
+    [[nodiscard]]
+    ValueType combine(const ValueType& v1, const ValueType& v2) const { return v1 + v2; }
+
+    void combine_many(ValueType& acc, std::span<const ValueType> logs) const {
+        ++*batches;
+        for (const auto &l : logs) {
+            acc.append(l);
+        }
+    }
+};
+
 }
 
 TEST_CASE("Writer with any semigroup") {
@@ -78,4 +118,83 @@ TEST_CASE("Writer with any semigroup") {
         const std::string bar = "bar";
         REQUIRE(logger.tell(bar, sg).log() == std::string("foobar"));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Semigroup wrapper storage") {
+    using Wrapper = fl::SemigroupWrapper<std::string>;
+    using test_any_semigroup::Joining;
+    using test_any_semigroup::SemigroupString;
+
+    static_assert(Wrapper::stores_inline<SemigroupString>);
+    static_assert(!Wrapper::stores_inline<Joining>);
+    static_assert(std::is_copy_constructible_v<Wrapper>);
+    static_assert(std::is_nothrow_move_constructible_v<Wrapper>);
+
+    SECTION("Inline") {
+        const Wrapper sg = SemigroupString();
+        const Wrapper copy = sg;
+
+        REQUIRE(sg.combine(std::string("foo"), std::string("bar")) == "foobar");
+        REQUIRE(copy.combine("foo", "bar") == "foobar");
+    }
+
+    SECTION("Heap") {
+        Wrapper sg = Joining{std::string(100, '-')};
+        const Wrapper copy = sg;
+        const Wrapper moved = std::move(sg);
+
+        REQUIRE(copy.combine("foo", "bar") == "foo" + std::string(100, '-') + "bar");
+        REQUIRE(moved.combine("foo", "bar") == "foo" + std::string(100, '-') + "bar");
+    }
+
+    SECTION("Assignment") {
+        Wrapper sg = SemigroupString();
+        const Wrapper joining = Joining{", "};
+
+        sg = joining;
+        REQUIRE(sg.combine("foo", "bar") == "foo, bar");
+
+        sg = SemigroupString();
+        REQUIRE(sg.combine("foo", "bar") == "foobar");
+    }
+
+    SECTION("Combine into") {
+        const Wrapper sg = Joining{", "};
+        std::string acc = "foo";
+        const std::string bar = "bar";
+
+        sg.combine_into(acc, bar);
+        sg.combine_into(acc, "baz");
+
+        REQUIRE(acc == "foo, bar, baz");
+    }
+
+    SECTION("Writer") {
+        using StringLogger = fl::Writer<std::string, int>;
+        const Wrapper sg = Joining{", "};
+
+        REQUIRE(StringLogger{"foo", 1}.tell("bar", sg).tell("baz", sg).log() == "foo, bar, baz");
+    }
+
+    SECTION("Combine many") {
+        const Wrapper sg = Joining{", "};
+        std::string acc = "foo";
+        const std::vector<std::string> logs{"bar", "baz"};
+
+        sg.combine_many(acc, logs);
+
+        REQUIRE(acc == "foo, bar, baz");
+    }
+
+    SECTION("Writer tell all") {
+        using StringLogger = fl::Writer<std::string, int>;
+        int batches = 0;
+        const Wrapper sg = test_any_semigroup::Batching{&batches};
+        const StringLogger w{"foo", 1};
+
+        REQUIRE(w.tell_all(std::vector<std::string>{"bar", "baz"}, sg).log() == "foobarbaz");
+        REQUIRE(StringLogger{"foo", 1}.tell_all(std::list{"bar", "baz"}, sg).log() == "foobarbaz");
+        REQUIRE(w.log() == "foo");
+        REQUIRE(batches == 2);
+    }
+}
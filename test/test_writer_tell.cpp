@@ -56,4 +56,14 @@ TEST_CASE("Writer method tell") {
 
         REQUIRE(result.log() == std::vector<std::string>{"foo", "foo"});
     }
-}
\ No newline at end of file
+
+    SECTION("Combine several entries at once") {
+        const auto l = Logger{{"foo"}, 1};
+        const std::vector<std::string> entries{"bar", "baz"};
+
+        REQUIRE(l.tell_all(entries).log() == Log{"foo", "bar", "baz"});
+        REQUIRE(l.log() == Log{"foo"});
+        REQUIRE(Logger{}.tell_all(std::vector{"foo", "bar"}).log() == Log{"foo", "bar"});
+        REQUIRE(Logger{{}, 1}.tell_all(std::vector<Log>{{"foo"}, {"bar", "baz"}}).log() == Log{"foo", "bar", "baz"});
+    }
+}